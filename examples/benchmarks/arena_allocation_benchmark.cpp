@@ -0,0 +1,197 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Counts the heap allocations and measures the load and teardown time of a constraint set, with the
+// default allocator and with all the data in one std::pmr::monotonic_buffer_resource.
+// Usage: ./arena_allocation_benchmark [number_of_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_pmr_data.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+static std::size_t number_of_allocations = 0;
+static std::size_t number_of_deallocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++number_of_allocations;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer)
+        ++number_of_deallocations;
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+// Used by std::pmr::new_delete_resource()
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++number_of_allocations;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1)/align*align))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(pointer);
+}
+
+struct Measurement{
+    double load_seconds = 0;
+    std::size_t load_allocations = 0;
+    double teardown_seconds = 0;
+    std::size_t teardown_deallocations = 0;
+};
+
+/**
+ * @brief measure runs load(), which must fill the storage, and then teardown(), which must release it.
+ */
+static Measurement measure(const std::function<void()>& load, const std::function<void()>& teardown)
+{
+    Measurement measurement;
+    const std::size_t allocations = number_of_allocations;
+    auto start = std::chrono::steady_clock::now();
+    load();
+    measurement.load_seconds = benchmark_utils::elapsed_seconds(start);
+    measurement.load_allocations = number_of_allocations - allocations;
+
+    const std::size_t deallocations = number_of_deallocations;
+    start = std::chrono::steady_clock::now();
+    teardown();
+    measurement.teardown_seconds = benchmark_utils::elapsed_seconds(start);
+    measurement.teardown_deallocations = number_of_deallocations - deallocations;
+    return measurement;
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 50000;
+    const std::string file = "arena_allocation_benchmark.yaml";
+    const auto source = benchmark_utils::make_synthetic_data(size);
+    {
+        VFIConfigurationFileYaml yaml;
+        yaml.save_data(source, 2, true, file);
+    }
+
+    std::cout << std::left << std::setw(14) << "case"
+              << std::setw(10) << "memory"
+              << std::setw(14) << "load [s]"
+              << std::setw(18) << "allocations"
+              << std::setw(16) << "teardown [s]"
+              << "deallocations" << std::endl;
+    auto print = [&](const std::string& name, const std::string& memory, const Measurement& measurement) {
+        std::cout << std::left << std::setw(14) << name
+                  << std::setw(10) << memory
+                  << std::setw(14) << measurement.load_seconds
+                  << std::setw(18) << measurement.load_allocations
+                  << std::setw(16) << measurement.teardown_seconds
+                  << measurement.teardown_deallocations << std::endl;
+    };
+
+    // Copy of an in-memory constraint set
+    {
+        std::optional<std::vector<VFIConfigurationFile::Data>> data;
+        print("copy", "heap", measure([&]() {
+            data.emplace(source);
+        }, [&]() {
+            data.reset();
+        }));
+    }
+    {
+        std::optional<std::pmr::monotonic_buffer_resource> arena;
+        std::optional<std::pmr::vector<VFIPmrData::Data>> data;
+        print("copy", "arena", measure([&]() {
+            arena.emplace();
+            data.emplace(&*arena);
+            data->reserve(source.size());
+            for (const auto& item : source)
+                data->push_back(VFIPmrData::from_data(item, data->get_allocator()));
+        }, [&]() {
+            data.reset();
+            arena.reset();
+        }));
+    }
+
+    // Streaming YAML load. The parser allocates on the heap in both cases.
+    for (const bool& use_arena : {false, true})
+    {
+        VFIConfigurationFileYaml yaml(VFIConfigurationFileYaml::LOAD_MODE::STREAMING);
+        std::optional<std::pmr::monotonic_buffer_resource> arena;
+        std::optional<std::pmr::vector<VFIPmrData::Data>> data;
+        print("yaml load", use_arena ? "arena" : "heap", measure([&]() {
+            if (use_arena)
+                arena.emplace();
+            data.emplace(use_arena ? &*arena : std::pmr::new_delete_resource());
+            yaml.load_pmr_data(file, *data);
+        }, [&]() {
+            data.reset();
+            arena.reset();
+        }));
+    }
+
+    // Editor store. Only the arrays of the store use the arena.
+    for (const bool& use_arena : {false, true})
+    {
+        auto yaml = std::make_shared<VFIConfigurationFileYaml>();
+        std::optional<std::pmr::monotonic_buffer_resource> arena;
+        std::optional<RobotConstraintEditor> editor;
+        print("editor", use_arena ? "arena" : "heap", measure([&]() {
+            if (use_arena)
+            {
+                arena.emplace();
+                editor.emplace(yaml, &*arena);
+            }
+            else
+                editor.emplace(yaml);
+            editor->add_data(source);
+        }, [&]() {
+            editor.reset();
+            arena.reset();
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace benchmark_utils
+{
+
+using DQ_robotics_extensions::VFIConfigurationFile;
+
+/**
+ * @brief make_synthetic_data creates a constraint set with alternating ENVIRONMENT_TO_ROBOT
+ *        and ROBOT_TO_ROBOT entries. The tags are "C0", "C1", ...
+ * @param size The number of entries.
+ * @param first_index The index of the first entry. It allows creating a large set in chunks.
+ * @return The desired data vector.
+ */
+inline std::vector<VFIConfigurationFile::Data> make_synthetic_data(const std::size_t& size,
+                                                                   const std::size_t& first_index = 0)
+{
+    std::vector<VFIConfigurationFile::Data> data;
+    data.reserve(size);
+    for (std::size_t i = first_index; i < first_index + size; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA env_data;
+            env_data.vfi_type = "ENVIRONMENT_TO_ROBOT";
+            env_data.cs_entity_environment = {"Cylinder_" + std::to_string(i % 97)};
+            env_data.cs_entity_robot = {"Sphere_" + std::to_string(i % 13)};
+            env_data.entity_environment_primitive_type = "LINE";
+            env_data.entity_robot_primitive_type = "POINT";
+            env_data.robot_index = static_cast<int>(i % 4) + 1;
+            env_data.joint_index = static_cast<int>(i % 7) + 1;
+            env_data.safe_distance = 0.1 + 0.001*static_cast<double>(i % 100);
+            env_data.buffer = 0.05;
+            env_data.vfi_gain = 1.0 + static_cast<double>(i % 3);
+            env_data.direction = "RESTRICTED_ZONE";
+            env_data.tag = "C" + std::to_string(i);
+            data.push_back(std::move(env_data));
+        }
+        else
+        {
+            VFIConfigurationFile::ROBOT_TO_ROBOT_DATA robot_data;
+            robot_data.vfi_type = "ROBOT_TO_ROBOT";
+            robot_data.cs_entity_one = {"line_1", "sphere_1_" + std::to_string(i % 11)};
+            robot_data.cs_entity_two = {"line_2", "sphere_2_" + std::to_string(i % 17)};
+            robot_data.entity_one_primitive_type = "LINESEGMENT";
+            robot_data.entity_two_primitive_type = "LINESEGMENT";
+            robot_data.robot_index_one = 1;
+            robot_data.robot_index_two = static_cast<int>(i % 3) + 2;
+            robot_data.joint_index_one = static_cast<int>(i % 7) + 1;
+            robot_data.joint_index_two = static_cast<int>(i % 6) + 1;
+            robot_data.safe_distance = 0.01 + 0.0001*static_cast<double>(i % 100);
+            robot_data.buffer = 0.05;
+            robot_data.vfi_gain = 0.5;
+            robot_data.direction = "RESTRICTED_ZONE";
+            robot_data.tag = "C" + std::to_string(i);
+            data.push_back(std::move(robot_data));
+        }
+    }
+    return data;
+}
+
+/**
+ * @brief elapsed_seconds returns the time elapsed since start.
+ */
+inline double elapsed_seconds(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief time_seconds returns the wall time of a function call.
+ */
+inline double time_seconds(const std::function<void()>& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return elapsed_seconds(start);
+}
+
+struct ProcessMeasurement{
+    double seconds;
+    long peak_rss_kb;
+};
+
+/**
+ * @brief measure_in_child_process runs a function in a forked process and measures its wall
+ *        time and its peak resident set size. Using a fresh process isolates the peak RSS of
+ *        each measurement.
+ * @param function The function to measure.
+ * @return The measured wall time and peak RSS.
+ */
+inline ProcessMeasurement measure_in_child_process(const std::function<void()>& function)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        throw std::runtime_error("measure_in_child_process: pipe() failed!");
+
+    pid_t pid = fork();
+    if (pid < 0)
+        throw std::runtime_error("measure_in_child_process: fork() failed!");
+    if (pid == 0)
+    {
+        close(fds[0]);
+        double seconds = time_seconds(function);
+        ssize_t written = write(fds[1], &seconds, sizeof(seconds));
+        _exit(written == sizeof(seconds) ? 0 : 1);
+    }
+    close(fds[1]);
+    double seconds = 0.0;
+    ssize_t bytes = read(fds[0], &seconds, sizeof(seconds));
+    close(fds[0]);
+
+    int status = 0;
+    struct rusage usage{};
+    wait4(pid, &status, 0, &usage);
+    if (bytes != sizeof(seconds) || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("measure_in_child_process: the child process failed!");
+    return {seconds, usage.ru_maxrss};
+}
+
+}
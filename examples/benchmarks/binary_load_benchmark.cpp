@@ -0,0 +1,80 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Compares the load time of VFIConfigurationFileBinary against VFIConfigurationFileYaml.
+// Usage: ./binary_load_benchmark [number_of_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary_view.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::string yaml_file = "binary_load_benchmark.yaml";
+    const std::string binary_file = "binary_load_benchmark.vfib";
+
+    const auto data = benchmark_utils::make_synthetic_data(size);
+    VFIConfigurationFileYaml().save_data(data, 2, false, yaml_file);
+    VFIConfigurationFileBinary().save_data(data, 2, false, binary_file);
+
+    const std::vector<std::pair<std::string, std::function<std::shared_ptr<VFIConfigurationFile>()>>> loaders = {
+        {"YAML (DOM)", []() { return std::make_shared<VFIConfigurationFileYaml>(VFIConfigurationFileYaml::LOAD_MODE::DOM); }},
+        {"YAML (STREAMING)", []() { return std::make_shared<VFIConfigurationFileYaml>(VFIConfigurationFileYaml::LOAD_MODE::STREAMING); }},
+        {"Binary", []() { return std::make_shared<VFIConfigurationFileBinary>(); }}
+    };
+    const std::vector<std::string> files = {yaml_file, yaml_file, binary_file};
+
+    std::cout << std::left << std::setw(20) << "backend"
+              << std::setw(14) << "entries"
+              << "load time [s]" << std::endl;
+    for (std::size_t i = 0; i < loaders.size(); ++i)
+    {
+        auto loader = loaders.at(i).second();
+        double seconds = benchmark_utils::time_seconds([&]() {
+            loader->load_data(files.at(i));
+        });
+        if (loader->get_data() != data)
+            throw std::runtime_error("The loaded data does not match the saved data!");
+        std::cout << std::left << std::setw(20) << loaders.at(i).first
+                  << std::setw(14) << size
+                  << seconds << std::endl;
+    }
+
+    // The memory-mapped view does not build any Data. The loop reads a field of each constraint.
+    double sum = 0.0;
+    double seconds = benchmark_utils::time_seconds([&]() {
+        VFIConfigurationFileBinaryView view(binary_file);
+        for (const auto& constraint : view)
+            sum += constraint.safe_distance() + static_cast<double>(constraint.tag().size());
+    });
+    std::cout << std::left << std::setw(20) << "Binary view (mmap)"
+              << std::setw(14) << size
+              << seconds << std::endl;
+    return sum > 0.0 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Compares a bulk numeric query ("safe_distance + buffer < X on robot 2", plus the mean vfi_gain of the
+// selected constraints) over the columnar snapshot of RobotConstraintEditor and over get_data() with a
+// std::visit loop. Usage: ./columns_query_benchmark [number_of_entries] [number_of_queries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+struct QueryResult{
+    std::size_t count = 0;
+    double mean_vfi_gain = 0.0;
+};
+
+static QueryResult visit_query(const std::vector<VFIConfigurationFile::Data>& data, const double& threshold)
+{
+    QueryResult result;
+    double sum = 0.0;
+    for (const auto& item : data)
+    {
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            bool on_robot;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>)
+                on_robot = arg.robot_index == 2;
+            else
+                on_robot = arg.robot_index_one == 2 || arg.robot_index_two == 2;
+            if (on_robot && arg.safe_distance + arg.buffer < threshold)
+            {
+                ++result.count;
+                sum += arg.vfi_gain;
+            }
+        }, item);
+    }
+    result.mean_vfi_gain = result.count ? sum/static_cast<double>(result.count) : 0.0;
+    return result;
+}
+
+static QueryResult columns_query(const ConstraintColumns& columns, const double& threshold)
+{
+    auto mask = columns.select(ConstraintColumns::COLUMN::CLEARANCE, ConstraintColumns::COMPARISON::LESS, threshold);
+    ConstraintColumns::mask_and(mask, columns.select_robot(2));
+    QueryResult result;
+    result.count = ConstraintColumns::count(mask);
+    result.mean_vfi_gain = result.count ? columns.mean(ConstraintColumns::COLUMN::VFI_GAIN, mask) : 0.0;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 200000;
+    const std::size_t queries = argc > 2 ? std::stoul(argv[2]) : 100;
+
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.add_data(benchmark_utils::make_synthetic_data(size));
+
+    std::vector<VFIConfigurationFile::Data> data;
+    const double get_data_seconds = benchmark_utils::time_seconds([&]() {
+        data = rce.get_data();
+    });
+    ConstraintColumns columns;
+    const double get_columns_seconds = benchmark_utils::time_seconds([&]() {
+        columns = rce.get_columns();
+    });
+
+    QueryResult visit_result;
+    QueryResult columns_result;
+    const double visit_seconds = benchmark_utils::time_seconds([&]() {
+        for (std::size_t q = 0; q < queries; ++q)
+            visit_result = visit_query(data, 0.13 + 0.0001*static_cast<double>(q));
+    });
+    const double columns_seconds = benchmark_utils::time_seconds([&]() {
+        for (std::size_t q = 0; q < queries; ++q)
+            columns_result = columns_query(columns, 0.13 + 0.0001*static_cast<double>(q));
+    });
+    if (visit_result.count != columns_result.count)
+        throw std::runtime_error("The queries selected different constraints!");
+
+    std::cout << "entries: " << size << ", queries: " << queries
+              << ", selected by the last query: " << columns_result.count << std::endl;
+    std::cout << std::left << std::setw(18) << "method"
+              << std::setw(20) << "snapshot [ms]"
+              << "query [ms/query]" << std::endl;
+    std::cout << std::left << std::setw(18) << "std::visit"
+              << std::setw(20) << 1e3*get_data_seconds
+              << 1e3*visit_seconds/static_cast<double>(queries) << std::endl;
+    std::cout << std::left << std::setw(18) << "columns"
+              << std::setw(20) << 1e3*get_columns_seconds
+              << 1e3*columns_seconds/static_cast<double>(queries) << std::endl;
+    return 0;
+}
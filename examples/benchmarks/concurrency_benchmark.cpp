@@ -0,0 +1,121 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+// Measures the contention between a thread that edits a RobotConstraintEditor and threads that read it
+// concurrently: with get_snapshot() (chunked snapshots published by the writer) and with get_data() (a full copy
+// under the lock of the editor). Reports the edit throughput of the writer, the longest edit (which
+// includes the time the writer waits for the lock), and the mean time per read. On a single core, the
+// throughput mostly reflects the share of the CPU left by the readers.
+// Build it with -fsanitize=thread to check the races.
+// Usage: ./concurrency_benchmark [number_of_entries] [number_of_edits]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+struct Measurement{
+    double edits_per_second;
+    double longest_edit_seconds;
+    double seconds_per_read;
+};
+
+static Measurement measure(RobotConstraintEditor& editor,
+                           const std::size_t& size,
+                           const std::size_t& number_of_edits,
+                           const std::size_t& number_of_readers,
+                           const bool& use_snapshots)
+{
+    const auto handle = RobotConstraintEditor::get_field_handle("vfi_gain");
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> number_of_reads{0};
+    std::atomic<std::size_t> checksum{0};
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < number_of_readers; ++r)
+        readers.emplace_back([&]() {
+            while (!done)
+            {
+                // Reads the whole data, like a validator or an exporter
+                std::size_t count = 0;
+                if (use_snapshots)
+                    editor.get_snapshot().visit_data([&](const VFIConfigurationFile::Data&) {++count;});
+                else
+                    count = editor.get_data().size();
+                checksum += count;
+                ++number_of_reads;
+            }
+        });
+
+    double longest_edit_seconds = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < number_of_edits; ++i)
+    {
+        const std::string tag = std::string("C").append(std::to_string((i*7919) % size));
+        const auto edit_start = std::chrono::steady_clock::now();
+        editor.edit_data(tag, handle, 0.5 + i);
+        longest_edit_seconds = std::max(longest_edit_seconds, benchmark_utils::elapsed_seconds(edit_start));
+    }
+    const double edit_seconds = benchmark_utils::elapsed_seconds(start);
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+    const double read_seconds = benchmark_utils::elapsed_seconds(start);
+
+    const std::size_t reads = number_of_reads;
+    if (reads > 0 && checksum != reads*size)
+        throw std::runtime_error("Inconsistent read!");
+    return {number_of_edits/edit_seconds, longest_edit_seconds, reads > 0 ? read_seconds*number_of_readers/reads : 0.0};
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::size_t number_of_edits = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+    RobotConstraintEditor editor(std::make_shared<VFIConfigurationFileBinary>());
+    editor.set_history_depth(0);
+    editor.add_data(benchmark_utils::make_synthetic_data(size));
+
+    std::cout << "entries: " << size << ", edits: " << number_of_edits
+              << ", hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::left << std::setw(14) << "readers" << std::setw(14) << "read with"
+              << std::setw(18) << "edits [1/s]" << std::setw(22) << "longest edit [ms]"
+              << "time per read [ms]" << std::endl;
+    for (const std::size_t number_of_readers : {0, 1, 2, 4})
+        for (const bool& use_snapshots : {true, false})
+        {
+            if (number_of_readers == 0 && !use_snapshots)
+                continue;
+            const auto measurement = measure(editor, size, number_of_edits, number_of_readers, use_snapshots);
+            std::cout << std::left << std::setw(14) << number_of_readers
+                      << std::setw(14) << (use_snapshots ? "snapshot" : "get_data")
+                      << std::setw(18) << measurement.edits_per_second
+                      << std::setw(22) << 1e3*measurement.longest_edit_seconds
+                      << 1e3*measurement.seconds_per_read << std::endl;
+        }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Measures add/lookup/edit/remove operations of RobotConstraintEditor.
+// Usage: ./editor_store_benchmark [number_of_tags ...]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    std::vector<std::size_t> sizes = {1000, 100000, 1000000};
+    if (argc > 1)
+    {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i)
+            sizes.push_back(std::stoul(argv[i]));
+    }
+
+    std::cout << std::left << std::setw(12) << "tags"
+              << std::setw(14) << "add [ns/op]"
+              << std::setw(16) << "lookup [ns/op]"
+              << std::setw(14) << "edit [ns/op]"
+              << std::setw(22) << "edit handle [ns/op]"
+              << "remove [ns/op]" << std::endl;
+    for (const auto& size : sizes)
+    {
+        const auto data = benchmark_utils::make_synthetic_data(size);
+        std::vector<std::string> tags;
+        tags.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+            tags.push_back(std::string("C").append(std::to_string((i*7919) % size))); // Visit the tags out of order
+
+        RobotConstraintEditor editor(std::make_shared<VFIConfigurationFileYaml>());
+        const double add = benchmark_utils::time_seconds([&]() {
+            for (const auto& item : data)
+                editor.add_data(item);
+        });
+        std::size_t found = 0;
+        const double lookup = benchmark_utils::time_seconds([&]() {
+            for (const auto& tag : tags)
+                found += editor.has_tag(tag) ? 1 : 0;
+        });
+        const double edit = benchmark_utils::time_seconds([&]() {
+            for (const auto& tag : tags)
+                editor.edit_data(tag, "vfi_gain", 2.0);
+        });
+        const auto vfi_gain = RobotConstraintEditor::get_field_handle("vfi_gain");
+        const double edit_handle = benchmark_utils::time_seconds([&]() {
+            for (const auto& tag : tags)
+                editor.edit_data(tag, vfi_gain, 3.0);
+        });
+        const double remove = benchmark_utils::time_seconds([&]() {
+            for (const auto& tag : tags)
+                editor.remove_data(tag);
+        });
+        if (found != size)
+            throw std::runtime_error("Lookup failed!");
+
+        const double ns = 1e9/static_cast<double>(size);
+        std::cout << std::left << std::setw(12) << size
+                  << std::setw(14) << add*ns
+                  << std::setw(16) << lookup*ns
+                  << std::setw(14) << edit*ns
+                  << std::setw(22) << edit_handle*ns
+                  << remove*ns << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Compares the memory used by a std::vector<VFIConfigurationFile::Data> and by an InternedConstraintSet
+// holding the same synthetic constraints. Usage: ./interned_memory_benchmark [number_of_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/interned_constraint_set.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const std::size_t chunk = 10000;
+
+    const auto baseline = benchmark_utils::measure_in_child_process([]() {});
+
+    std::cout << std::left << std::setw(24) << "storage"
+              << std::setw(14) << "entries"
+              << std::setw(14) << "time [s]"
+              << std::setw(26) << "peak RSS increase [MiB]"
+              << "bytes/entry" << std::endl;
+    auto print = [&](const std::string& name, const benchmark_utils::ProcessMeasurement& measurement) {
+        const double bytes = static_cast<double>(measurement.peak_rss_kb - baseline.peak_rss_kb)*1024.0;
+        std::cout << std::left << std::setw(24) << name
+                  << std::setw(14) << size
+                  << std::setw(14) << measurement.seconds
+                  << std::setw(26) << bytes/(1024.0*1024.0)
+                  << bytes/static_cast<double>(size) << std::endl;
+    };
+
+    print("std::vector<Data>", benchmark_utils::measure_in_child_process([&]() {
+        std::vector<VFIConfigurationFile::Data> data;
+        data.reserve(size);
+        for (std::size_t first = 0; first < size; first += chunk)
+            for (auto& item : benchmark_utils::make_synthetic_data(std::min(chunk, size - first), first))
+                data.push_back(std::move(item));
+        if (data.size() != size)
+            throw std::runtime_error("Wrong number of entries!");
+    }));
+
+    print("InternedConstraintSet", benchmark_utils::measure_in_child_process([&]() {
+        InternedConstraintSet interned_data;
+        interned_data.reserve(size);
+        for (std::size_t first = 0; first < size; first += chunk)
+            interned_data.add_data(benchmark_utils::make_synthetic_data(std::min(chunk, size - first), first));
+        if (interned_data.size() != size)
+            throw std::runtime_error("Wrong number of entries!");
+        std::cout << "InternedConstraintSet::memory_usage(): "
+                  << static_cast<double>(interned_data.memory_usage())/(1024.0*1024.0) << " MiB, "
+                  << interned_data.get_symbols()->size() << " symbols" << std::endl;
+    }));
+    return 0;
+}
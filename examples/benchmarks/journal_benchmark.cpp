@@ -0,0 +1,93 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+// Measures the cost of an edit with the write-ahead journal of RobotConstraintEditor (group commit in a
+// background thread), compared with saving the changes (save_changes()) or the whole data (save_data())
+// after each edit, and the time to recover the data (load_data() of the base file plus the journal).
+// Usage: ./journal_benchmark [number_of_entries] [number_of_edits]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::size_t number_of_edits = argc > 2 ? std::stoul(argv[2]) : 10000;
+    const std::size_t number_of_saves = 100;
+    const std::string file = "journal_benchmark.vfib";
+    const auto handle = RobotConstraintEditor::get_field_handle("vfi_gain");
+
+    RobotConstraintEditor editor(std::make_shared<VFIConfigurationFileBinary>());
+    editor.add_data(benchmark_utils::make_synthetic_data(size));
+    editor.set_compaction_threshold(2*number_of_edits);
+    editor.save_data(file, 2, false);
+
+    const double full_save_seconds = benchmark_utils::time_seconds([&]() {
+        editor.save_data(file, 2, false);
+    });
+    const double save_changes_seconds = benchmark_utils::time_seconds([&]() {
+        for (std::size_t i = 0; i < number_of_saves; ++i)
+        {
+            editor.edit_data(std::string("C").append(std::to_string((i*7919) % size)), handle, 0.5 + i);
+            editor.save_changes(file, 2, false);
+        }
+    });
+
+    editor.save_data(file, 2, false);
+    editor.start_journal(file, 2, false, std::chrono::milliseconds(10));
+    const double journal_seconds = benchmark_utils::time_seconds([&]() {
+        for (std::size_t i = 0; i < number_of_edits; ++i)
+            editor.edit_data(std::string("C").append(std::to_string((i*7919) % size)), handle, 1.5 + i);
+        editor.flush_journal();
+    });
+    editor.stop_journal();
+    const auto journal_size = std::filesystem::file_size(file + ".delta");
+
+    RobotConstraintEditor recovered(std::make_shared<VFIConfigurationFileBinary>());
+    const double recovery_seconds = benchmark_utils::time_seconds([&]() {
+        recovered.load_data(file);
+    });
+    if (recovered.get_data() != editor.get_data())
+        throw std::runtime_error("The recovered data is different!");
+    std::filesystem::remove(file + ".delta");
+    RobotConstraintEditor reloaded(std::make_shared<VFIConfigurationFileBinary>());
+    const double load_seconds = benchmark_utils::time_seconds([&]() {
+        reloaded.load_data(file);
+    });
+
+    std::cout << "entries: " << size << ", edits: " << number_of_edits
+              << ", journal: " << journal_size << " bytes" << std::endl;
+    std::cout << std::left << std::setw(40) << "method" << "time [us/edit]" << std::endl;
+    std::cout << std::left << std::setw(40) << "edit + journal (group commit)"
+              << 1e6*journal_seconds/static_cast<double>(number_of_edits) << std::endl;
+    std::cout << std::left << std::setw(40) << "edit + save_changes()"
+              << 1e6*save_changes_seconds/static_cast<double>(number_of_saves) << std::endl;
+    std::cout << std::left << std::setw(40) << "edit + save_data()" << 1e6*full_save_seconds << std::endl;
+    std::cout << std::left << std::setw(40) << "load_data() without journal [ms]" << 1e3*load_seconds << std::endl;
+    std::cout << std::left << std::setw(40) << "load_data() with journal [ms]" << 1e3*recovery_seconds << std::endl;
+    return 0;
+}
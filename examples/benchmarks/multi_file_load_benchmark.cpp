@@ -0,0 +1,74 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Measures RobotConstraintEditor::load_data with several files for 1 to N worker threads.
+// Usage: ./multi_file_load_benchmark [number_of_files] [entries_per_file] [max_threads]
+
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t number_of_files = argc > 1 ? std::stoul(argv[1]) : 32;
+    const std::size_t size = argc > 2 ? std::stoul(argv[2]) : 5000;
+    const std::size_t max_threads = argc > 3 ? std::stoul(argv[3]) :
+                                        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    auto yaml = std::make_shared<VFIConfigurationFileYaml>(VFIConfigurationFileYaml::LOAD_MODE::STREAMING);
+    std::vector<std::string> config_files;
+    for (std::size_t i = 0; i < number_of_files; ++i)
+    {
+        auto data = benchmark_utils::make_synthetic_data(size);
+        const std::string prefix = std::string("F").append(std::to_string(i)).append("_");
+        for (auto& item : data)
+            std::visit([&](auto& arg) { arg.tag = prefix + arg.tag; }, item);
+        config_files.push_back(std::string("multi_file_load_benchmark_").append(std::to_string(i)).append(".yaml"));
+        yaml->save_data(data, 2, false, config_files.back());
+    }
+
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(14) << "time [s]"
+              << "speedup" << std::endl;
+    double serial_time = 0.0;
+    for (std::size_t threads = 1; threads <= max_threads; ++threads)
+    {
+        RobotConstraintEditor editor(yaml);
+        const double time = benchmark_utils::time_seconds([&]() {
+            editor.load_data(config_files, threads);
+        });
+        if (editor.get_data().size() != number_of_files*size)
+            throw std::runtime_error("Wrong number of entries!");
+        if (threads == 1)
+            serial_time = time;
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(14) << time
+                  << serial_time/time << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+// Measures the load time of a YAML file with VFIConfigurationFileYaml, without a ParseCache, on a cache
+// miss (parse plus writing the entry) and on a cache hit (digest of the file plus reading the entry).
+// Usage: ./parse_cache_benchmark [number_of_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/parse_cache.hpp>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::string file = "parse_cache_benchmark.yaml";
+    const std::string cache_directory = "parse_cache_benchmark_cache";
+
+    const auto data = benchmark_utils::make_synthetic_data(size);
+    VFIConfigurationFileYaml().save_data(data, 2, false, file);
+    auto cache = std::make_shared<ParseCache>(cache_directory);
+    cache->clear();
+
+    VFIConfigurationFileYaml uncached;
+    VFIConfigurationFileYaml cached;
+    cached.set_parse_cache(cache);
+    const double parse_seconds = benchmark_utils::time_seconds([&]() {
+        uncached.load_data(file);
+    });
+    const double miss_seconds = benchmark_utils::time_seconds([&]() {
+        cached.load_data(file);
+    });
+    const double hit_seconds = benchmark_utils::time_seconds([&]() {
+        cached.load_data(file);
+    });
+    if (cached.get_data() != data || cache->get_number_of_hits() != 1)
+        throw std::runtime_error("The cached data does not match the saved data!");
+
+    std::cout << "entries: " << size << std::endl;
+    std::cout << std::left << std::setw(30) << "method" << "load time [s]" << std::endl;
+    std::cout << std::left << std::setw(30) << "YAML without cache" << parse_seconds << std::endl;
+    std::cout << std::left << std::setw(30) << "YAML, cache miss" << miss_seconds << std::endl;
+    std::cout << std::left << std::setw(30) << "YAML, cache hit" << hit_seconds << std::endl;
+    cache->clear();
+    std::filesystem::remove(cache_directory);
+    return 0;
+}
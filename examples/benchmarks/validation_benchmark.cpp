@@ -0,0 +1,106 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Compares the cost of ConstraintValidation::validate() with a scalar std::visit loop and with the
+// STREAMING YAML parse of the same kind of data.
+// Usage: ./validation_benchmark [number_of_entries] [number_of_parsed_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_validation.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+static std::size_t visit_validate(const std::vector<VFIConfigurationFile::Data>& data, const int& min_index)
+{
+    std::size_t violations = 0;
+    for (const auto& item : data)
+    {
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            bool invalid_index;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>)
+                invalid_index = arg.robot_index < min_index || arg.joint_index < min_index;
+            else
+                invalid_index = arg.robot_index_one < min_index || arg.robot_index_two < min_index ||
+                                arg.joint_index_one < min_index || arg.joint_index_two < min_index;
+            if (!(arg.safe_distance >= 0.0) || !(arg.buffer >= 0.0) || !std::isfinite(arg.vfi_gain) || invalid_index)
+                ++violations;
+        }, item);
+    }
+    return violations;
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const std::size_t parsed_size = argc > 2 ? std::stoul(argv[2]) : 20000;
+
+    auto data = benchmark_utils::make_synthetic_data(size);
+    // One bad entry every 10007
+    for (std::size_t i = 0; i < size; i += 10007)
+        std::visit([](auto&& arg) {
+            arg.vfi_gain = std::numeric_limits<double>::quiet_NaN();
+        }, data[i]);
+    const std::size_t expected = (size + 10006)/10007;
+
+    ConstraintColumns columns;
+    columns.add_data(data);
+
+    std::size_t visit_violations = 0;
+    ConstraintValidation::Report report;
+    ConstraintValidation::Report columns_report;
+    const double visit_seconds = benchmark_utils::time_seconds([&]() {
+        visit_violations = visit_validate(data, 1);
+    });
+    const double validate_seconds = benchmark_utils::time_seconds([&]() {
+        report = ConstraintValidation::validate(data, false);
+    });
+    const double columns_seconds = benchmark_utils::time_seconds([&]() {
+        columns_report = ConstraintValidation::validate(columns, false);
+    });
+    if (visit_violations != expected || report.violations.size() != expected ||
+        columns_report.violations.size() != expected)
+        throw std::runtime_error("Wrong number of violations!");
+
+    const std::string file = "validation_benchmark.yaml";
+    VFIConfigurationFileYaml yaml(VFIConfigurationFileYaml::LOAD_MODE::STREAMING);
+    yaml.save_data(benchmark_utils::make_synthetic_data(parsed_size), 2, false, file);
+    const double parse_seconds = benchmark_utils::time_seconds([&]() {
+        yaml.load_data(file);
+    });
+
+    auto per_entry = [](const double& seconds, const std::size_t& entries) {
+        return 1e9*seconds/static_cast<double>(entries);
+    };
+    std::cout << "entries: " << size << ", violations: " << expected << std::endl;
+    std::cout << std::left << std::setw(34) << "method" << "time [ns/entry]" << std::endl;
+    std::cout << std::left << std::setw(34) << "std::visit loop (scalar)" << per_entry(visit_seconds, size) << std::endl;
+    std::cout << std::left << std::setw(34) << "validate(vector<Data>)" << per_entry(validate_seconds, size) << std::endl;
+    std::cout << std::left << std::setw(34) << "validate(ConstraintColumns)" << per_entry(columns_seconds, size) << std::endl;
+    std::cout << std::left << std::setw(34) << "YAML STREAMING parse" << per_entry(parse_seconds, parsed_size) << std::endl;
+    return 0;
+}
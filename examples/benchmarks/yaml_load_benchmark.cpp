@@ -0,0 +1,65 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Compares the peak RSS and the wall time of the DOM and STREAMING load modes of
+// VFIConfigurationFileYaml. Usage: ./yaml_load_benchmark [number_of_entries]
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 200000;
+    const std::string config_file = "yaml_load_benchmark.yaml";
+
+    VFIConfigurationFileYaml yaml;
+    yaml.save_data(benchmark_utils::make_synthetic_data(size), 2, false, config_file);
+
+    const std::vector<std::pair<std::string, VFIConfigurationFileYaml::LOAD_MODE>> modes = {
+        {"DOM", VFIConfigurationFileYaml::LOAD_MODE::DOM},
+        {"STREAMING", VFIConfigurationFileYaml::LOAD_MODE::STREAMING}
+    };
+
+    std::cout << std::left << std::setw(12) << "mode"
+              << std::setw(14) << "entries"
+              << std::setw(14) << "time [s]"
+              << "peak RSS [MiB]" << std::endl;
+    for (const auto& [name, mode] : modes)
+    {
+        auto measurement = benchmark_utils::measure_in_child_process([&]() {
+            VFIConfigurationFileYaml loader(mode);
+            loader.load_data(config_file);
+            if (loader.get_data().size() != size)
+                throw std::runtime_error("Wrong number of entries!");
+        });
+        std::cout << std::left << std::setw(12) << name
+                  << std::setw(14) << size
+                  << std::setw(14) << measurement.seconds
+                  << static_cast<double>(measurement.peak_rss_kb)/1024.0 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Measures the LOAD_MODE::PARALLEL_DOM mode of VFIConfigurationFileYaml for 1 to N threads,
+// compared with LOAD_MODE::DOM. Usage: ./yaml_parallel_load_benchmark [number_of_entries] [max_threads]
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::size_t max_threads = argc > 2 ? std::stoul(argv[2]) :
+                                        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const std::string config_file = "yaml_parallel_load_benchmark.yaml";
+
+    VFIConfigurationFileYaml yaml;
+    yaml.save_data(benchmark_utils::make_synthetic_data(size), 2, false, config_file);
+
+    auto load = [&](const VFIConfigurationFileYaml::LOAD_MODE& mode, const std::size_t& threads) {
+        return benchmark_utils::time_seconds([&]() {
+            VFIConfigurationFileYaml loader(mode);
+            loader.set_number_of_threads(threads);
+            loader.load_data(config_file);
+            if (loader.get_data().size() != size)
+                throw std::runtime_error("Wrong number of entries!");
+        });
+    };
+
+    const double dom_time = load(VFIConfigurationFileYaml::LOAD_MODE::DOM, 1);
+    std::cout << std::left << std::setw(16) << "mode"
+              << std::setw(10) << "threads"
+              << std::setw(14) << "time [s]"
+              << "speedup" << std::endl;
+    std::cout << std::left << std::setw(16) << "DOM"
+              << std::setw(10) << 1
+              << std::setw(14) << dom_time
+              << 1.0 << std::endl;
+    for (std::size_t threads = 1; threads <= max_threads; ++threads)
+    {
+        const double time = load(VFIConfigurationFileYaml::LOAD_MODE::PARALLEL_DOM, threads);
+        std::cout << std::left << std::setw(16) << "PARALLEL_DOM"
+                  << std::setw(10) << threads
+                  << std::setw(14) << time
+                  << dom_time/time << std::endl;
+    }
+    return 0;
+}
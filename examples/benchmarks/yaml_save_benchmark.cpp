@@ -0,0 +1,65 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+// Measures the throughput of VFIConfigurationFileYaml::save_data in entries per second.
+// Usage: ./yaml_save_benchmark [number_of_entries ...]
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
+#include <iomanip>
+#include <iostream>
+#include "benchmark_utils.hpp"
+using namespace DQ_robotics_extensions;
+
+
+int main(int argc, char** argv)
+{
+    std::vector<std::size_t> sizes = {100000, 250000, 500000, 1000000};
+    if (argc > 1)
+    {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i)
+            sizes.push_back(std::stoul(argv[i]));
+    }
+    const std::string config_file = "yaml_save_benchmark.yaml";
+
+    VFIConfigurationFileYaml yaml;
+    std::vector<std::tuple<std::size_t, double>> results;
+    for (const auto& size : sizes)
+    {
+        const auto data = benchmark_utils::make_synthetic_data(size);
+        double seconds = benchmark_utils::time_seconds([&]() {
+            yaml.save_data(data, 2, false, config_file);
+        });
+        results.emplace_back(size, seconds);
+    }
+
+    std::cout << std::left << std::setw(14) << "entries"
+              << std::setw(14) << "time [s]"
+              << "entries/s" << std::endl;
+    for (const auto& [size, seconds] : results)
+        std::cout << std::left << std::setw(14) << size
+                  << std::setw(14) << seconds
+                  << std::fixed << std::setprecision(0) << static_cast<double>(size)/seconds
+                  << std::defaultfloat << std::setprecision(6) << std::endl;
+    return 0;
+}
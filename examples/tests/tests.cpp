@@ -2,9 +2,1121 @@
 #include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_yaml.hpp>
 #include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
 #include <dqrobotics_extensions/robot_constraint_editor/utils.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary_view.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <thread>
 using namespace DQ_robotics_extensions;
 
+// Counts the allocations of the program, to check that some operations do not copy strings. Some
+// operations allocate memory in other threads. Every form of new and delete is replaced, so that each
+// delete matches its new.
+static std::atomic<std::size_t> number_of_allocations{0};
 
+static void* allocate(std::size_t size, const std::size_t& alignment = 0)
+{
+    number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0)
+        size = 1;
+    void* ptr = alignment == 0 ? std::malloc(size)
+                               : std::aligned_alloc(alignment, (size + alignment - 1)/alignment*alignment);
+    if (ptr)
+        return ptr;
+    throw std::bad_alloc();
+}
+
+// Not inlined, so that GCC does not pair the std::free() with a call of the replaced operator new
+// (-Wmismatched-new-delete)
+[[gnu::noinline]] static void deallocate(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr);
+}
+
+
+/**
+ * @brief check prints the result of a test.
+ * @return The value of condition.
+ */
+static bool check(const bool& condition, const std::string& test_name)
+{
+    std::cout << (condition ? "[PASSED] " : "[FAILED] ") << test_name << std::endl;
+    return condition;
+}
+
+/**
+ * @brief test_yaml_binary_round_trip converts the YAML file to the binary format and back, and
+ *        checks that no information is lost.
+ */
+static bool test_yaml_binary_round_trip()
+{
+    auto yaml = std::make_shared<VFIConfigurationFileYaml>();
+    yaml->load_data("config_file.yaml");
+
+    auto binary = std::make_shared<VFIConfigurationFileBinary>();
+    binary->save_data(yaml->get_data(), yaml->get_vfi_file_version(), yaml->is_zero_indexed(), "config_file.vfib");
+    binary->load_data("config_file.vfib");
+    bool passed = check(binary->get_data() == yaml->get_data() &&
+                        binary->get_vfi_file_version() == yaml->get_vfi_file_version() &&
+                        binary->is_zero_indexed() == yaml->is_zero_indexed(),
+                        "YAML to binary round trip");
+
+    auto yaml_round_trip = std::make_shared<VFIConfigurationFileYaml>();
+    yaml_round_trip->save_data(binary->get_data(), binary->get_vfi_file_version(), binary->is_zero_indexed(),
+                               "config_file_round_trip.yaml");
+    yaml_round_trip->load_data("config_file_round_trip.yaml");
+    passed = check(yaml_round_trip->get_data() == yaml->get_data() &&
+                   yaml_round_trip->get_vfi_file_version() == yaml->get_vfi_file_version() &&
+                   yaml_round_trip->is_zero_indexed() == yaml->is_zero_indexed(),
+                   "Binary to YAML round trip") && passed;
+
+    VFIConfigurationFileBinaryView view("config_file.vfib");
+    std::vector<VFIConfigurationFile::Data> view_data;
+    for (const auto& constraint : view)
+        view_data.push_back(constraint.to_data());
+    passed = check(view_data == yaml->get_data() &&
+                   view.get_vfi_file_version() == yaml->get_vfi_file_version() &&
+                   view.is_zero_indexed() == yaml->is_zero_indexed(),
+                   "Memory-mapped binary view") && passed;
+    return passed;
+}
+
+static std::string read_file(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief test_streaming_load checks that LOAD_MODE::STREAMING loads the same data as LOAD_MODE::DOM, and
+ *        reports the same errors, including a syntax error after an invalid item.
+ */
+static bool test_streaming_load()
+{
+    VFIConfigurationFileYaml dom;
+    dom.load_data("config_file.yaml");
+    VFIConfigurationFileYaml streaming(VFIConfigurationFileYaml::LOAD_MODE::STREAMING);
+    streaming.load_data("config_file.yaml");
+    bool passed = check(streaming.get_data() == dom.get_data() &&
+                        streaming.get_vfi_file_version() == dom.get_vfi_file_version() &&
+                        streaming.is_zero_indexed() == dom.is_zero_indexed(), "Streaming load");
+
+    const auto load_error = [](const VFIConfigurationFileYaml::LOAD_MODE& load_mode) {
+        VFIConfigurationFileYaml yaml(load_mode);
+        try {
+            yaml.load_data("config_file_invalid.yaml");
+        } catch (const std::exception& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    std::string content = read_file("config_file.yaml");
+    const std::size_t joint_index = content.find("joint_index: 1");
+    content.replace(joint_index, 14, "joint_index: one");
+    std::ofstream("config_file_invalid.yaml", std::ios::binary) << content;
+    const std::string item_error = load_error(VFIConfigurationFileYaml::LOAD_MODE::DOM);
+    passed = check(!item_error.empty() && load_error(VFIConfigurationFileYaml::LOAD_MODE::STREAMING) == item_error,
+                   "Streaming load error") && passed;
+
+    std::ofstream("config_file_invalid.yaml", std::ios::binary) << content << "  - [unclosed" << std::endl;
+    const std::string syntax_error = load_error(VFIConfigurationFileYaml::LOAD_MODE::DOM);
+    return check(!syntax_error.empty() && syntax_error != item_error &&
+                 load_error(VFIConfigurationFileYaml::LOAD_MODE::STREAMING) == syntax_error,
+                 "Streaming load syntax error") && passed;
+}
+
+/**
+ * @brief test_yaml_double_round_trip checks that the doubles are saved without losing digits, where the
+ *        six significant digits of std::ostream lost them (e.g. 1234567.125 was written as 1.23457e+06).
+ */
+static bool test_yaml_double_round_trip()
+{
+    VFIConfigurationFileYaml yaml;
+    yaml.load_data("config_file.yaml");
+    auto data = yaml.get_data();
+    std::visit([](auto&& arg) {
+        arg.safe_distance = 1234567.125;
+        arg.buffer = 0.1 + 0.2;
+        arg.vfi_gain = 1e6;
+    }, data.front());
+    yaml.save_data(data, yaml.get_vfi_file_version(), yaml.is_zero_indexed(), "config_file_doubles.yaml");
+    const std::string content = read_file("config_file_doubles.yaml");
+    bool passed = check(content.find("1234567.125") != std::string::npos &&
+                        content.find("1.23457e+06") == std::string::npos &&
+                        content.find("0.05") != std::string::npos, "Doubles saved exactly");
+
+    VFIConfigurationFileYaml reloaded;
+    reloaded.load_data("config_file_doubles.yaml");
+    return check(reloaded.get_data() == data, "Doubles round trip") && passed;
+}
+
+/**
+ * @brief test_atomic_save checks that a failed save in the FileWriter::SAVE_MODE::ATOMIC mode leaves the
+ *        target file untouched, and does not leave the temporary file behind.
+ */
+static bool test_atomic_save()
+{
+    const auto has_temporary_files = [](const std::string& target) {
+        for (const auto& entry : std::filesystem::directory_iterator("."))
+            if (entry.path().filename().string().rfind(target + ".tmp.", 0) == 0)
+                return true;
+        return false;
+    };
+    VFIConfigurationFileYaml yaml;
+    yaml.load_data("config_file.yaml");
+    yaml.set_save_mode(FileWriter::SAVE_MODE::ATOMIC);
+    yaml.save_data(yaml.get_data(), yaml.get_vfi_file_version(), yaml.is_zero_indexed(), "config_file_atomic.yaml");
+    const std::string saved = read_file("config_file_atomic.yaml");
+
+    FileWriter writer(FileWriter::SAVE_MODE::ATOMIC);
+    writer.open("config_file_atomic.yaml");
+    writer.write("partial", 7);
+    writer.discard();
+    bool passed = check(read_file("config_file_atomic.yaml") == saved && !has_temporary_files("config_file_atomic.yaml"),
+                        "Discarded atomic save");
+
+    // The temporary file cannot replace a directory
+    std::filesystem::create_directory("config_file_atomic_directory.yaml");
+    bool failed = false;
+    try {
+        yaml.save_data(yaml.get_data(), yaml.get_vfi_file_version(), yaml.is_zero_indexed(),
+                       "config_file_atomic_directory.yaml");
+    } catch (const std::runtime_error&) {
+        failed = true;
+    }
+    return check(failed && std::filesystem::is_directory("config_file_atomic_directory.yaml") &&
+                 !has_temporary_files("config_file_atomic_directory.yaml"), "Failed atomic save") && passed;
+}
+
+/**
+ * @brief test_parallel_dom_load checks that LOAD_MODE::PARALLEL_DOM loads the same data as LOAD_MODE::DOM.
+ */
+static bool test_parallel_dom_load()
+{
+    VFIConfigurationFileYaml dom;
+    dom.load_data("config_file.yaml");
+    VFIConfigurationFileYaml parallel(VFIConfigurationFileYaml::LOAD_MODE::PARALLEL_DOM);
+    parallel.set_number_of_threads(2);
+    parallel.load_data("config_file.yaml");
+    return check(parallel.get_data() == dom.get_data(), "Parallel DOM load");
+}
+
+/**
+ * @brief test_interned_data loads, edits and saves the data through an InternedConstraintSet.
+ */
+static bool test_interned_data()
+{
+    VFIConfigurationFileYaml dom;
+    dom.load_data("config_file.yaml");
+
+    VFIConfigurationFileYaml streaming(VFIConfigurationFileYaml::LOAD_MODE::STREAMING);
+    InternedConstraintSet interned_data;
+    streaming.load_interned_data("config_file.yaml", interned_data);
+    bool passed = check(interned_data.get_data() == dom.get_data(), "Interned load");
+
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.add_data(interned_data);
+    passed = check(rce.get_interned_data().get_data() == rce.get_data(), "Interned editor data") && passed;
+
+    streaming.save_interned_data(interned_data, dom.get_vfi_file_version(), dom.is_zero_indexed(),
+                                 "config_file_interned.yaml");
+    VFIConfigurationFileYaml reloaded;
+    reloaded.load_data("config_file_interned.yaml");
+    return check(reloaded.get_data() == dom.get_data(), "Interned save") && passed;
+}
+
+/**
+ * @brief test_store_removal removes constraints from the middle of the probe chains of the hash table of
+ *        the editor. Each removal shifts the following entries of its chain back, so all the other tags
+ *        must still be found, and the removed tags must be free to add again.
+ */
+static bool test_store_removal()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    const auto data = rce.get_data("C1");
+    constexpr int number_of_tags = 2000;
+    const auto tag_of = [](const int& i) {
+        return "T" + std::to_string(i);
+    };
+    for (int i = 0; i < number_of_tags; ++i)
+    {
+        auto new_data = data;
+        std::visit([&](auto&& arg) {
+            arg.tag = tag_of(i);
+        }, new_data);
+        rce.add_data(new_data);
+    }
+    // A tag lost by a removal cannot be removed
+    bool found = true;
+    for (int i = 0; i < number_of_tags; ++i)
+    {
+        try {
+            if (i % 3 != 0)
+                rce.remove_data(tag_of(i));
+        } catch (const std::runtime_error&) {
+            found = false;
+        }
+    }
+    for (int i = 0; i < number_of_tags; ++i)
+    {
+        const bool kept = i % 3 == 0;
+        found = found && rce.has_tag(tag_of(i)) == kept &&
+                (!kept || std::visit([](auto&& arg) {return arg.tag;}, rce.get_data(tag_of(i))) == tag_of(i));
+    }
+    bool passed = check(found && rce.has_tag("C1") && rce.get_data().size() == 3 + (number_of_tags + 2)/3,
+                        "Removal from the hash table");
+
+    for (int i = 1; i < number_of_tags; i += 3)
+    {
+        auto new_data = data;
+        std::visit([&](auto&& arg) {
+            arg.tag = tag_of(i);
+        }, new_data);
+        rce.add_data(new_data);
+    }
+    bool added = true;
+    for (int i = 0; i < number_of_tags; ++i)
+        added = added && rce.has_tag(tag_of(i)) == (i % 3 != 2);
+    return check(added, "Add again after removal") && passed;
+}
+
+/**
+ * @brief test_batch_edit checks that a batch of edits is applied atomically, and the edits with a field handle.
+ */
+static bool test_batch_edit()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    const auto original = rce.get_data();
+
+    using EditOperation = RobotConstraintEditor::EditOperation;
+    bool failed = false;
+    try {
+        rce.edit_data(std::vector<EditOperation>{{"C1", "safe_distance", 0.5},
+                                                 {"C2", "unknown_key", 1}});
+    } catch (const std::runtime_error&) {
+        failed = true;
+    }
+    bool passed = check(failed && rce.get_data() == original, "Failed batch edit leaves the data unchanged");
+
+    rce.edit_data(std::vector<EditOperation>{{"C1", "tag", std::string("TMP")},
+                                             {"C2", "tag", std::string("C1")},
+                                             {"TMP", "tag", std::string("C2")}});
+    passed = check(rce.has_tag("C1") && rce.has_tag("C2") && !rce.has_tag("TMP") &&
+                   rce.get_data().size() == original.size(),
+                   "Batch edit swaps tags") && passed;
+
+    const auto vfi_gain = RobotConstraintEditor::get_field_handle("vfi_gain");
+    rce.edit_data("C1", vfi_gain, 7.5);
+    rce.edit_data("C1", "safe_distance", 0.25);
+    bool found = false;
+    for (const auto& data : rce.get_data())
+        std::visit([&](const auto& arg) {
+            if (arg.tag == "C1")
+                found = arg.vfi_gain == 7.5 && arg.safe_distance == 0.25;
+        }, data);
+    passed = check(found, "Edit with a field handle") && passed;
+    return passed;
+}
+
+
+/**
+ * @brief test_multi_file_load loads several files concurrently and checks the tag conflicts.
+ */
+static bool test_multi_file_load()
+{
+    auto yaml = std::make_shared<VFIConfigurationFileYaml>();
+    auto rce = RobotConstraintEditor(yaml);
+    rce.load_data(std::vector<std::string>{"config_file.yaml"}, 2);
+    const auto data = rce.get_data();
+
+    auto serial = RobotConstraintEditor(yaml);
+    serial.load_data("config_file.yaml");
+    bool passed = check(data == serial.get_data(), "Multi-file load of one file");
+
+    // A copy of the file defines the same tags
+    VFIConfigurationFileYaml copy;
+    copy.load_data("config_file.yaml");
+    copy.save_data(copy.get_data(), copy.get_vfi_file_version(), copy.is_zero_indexed(), "config_file_copy.yaml");
+    bool failed = false;
+    try {
+        auto conflict = RobotConstraintEditor(yaml);
+        conflict.load_data(std::vector<std::string>{"config_file.yaml", "config_file_copy.yaml"}, 2);
+    } catch (const std::runtime_error& e) {
+        failed = std::string(e.what()).find("is also defined in 'config_file.yaml'") != std::string::npos;
+    }
+    return check(failed, "Multi-file load reports repeated tags") && passed;
+}
+
+/**
+ * @brief test_pmr_data loads the data into std::pmr structs allocated in a memory arena, with both load
+ *        modes, and checks an editor whose store is in an arena.
+ */
+static bool test_pmr_data()
+{
+    VFIConfigurationFileYaml dom;
+    dom.load_data("config_file.yaml");
+    const auto expected = dom.get_data();
+
+    bool passed = true;
+    for (const auto& load_mode : {VFIConfigurationFileYaml::LOAD_MODE::DOM,
+                                  VFIConfigurationFileYaml::LOAD_MODE::STREAMING})
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::vector<VFIPmrData::Data> data(&arena);
+        VFIConfigurationFileYaml yaml(load_mode);
+        yaml.load_pmr_data("config_file.yaml", data);
+
+        bool in_arena = !data.empty();
+        std::vector<VFIConfigurationFile::Data> converted;
+        for (const auto& item : data)
+        {
+            std::visit([&](const auto& arg) {
+                in_arena = in_arena && arg.get_allocator().resource() == &arena;
+            }, item);
+            converted.push_back(VFIPmrData::to_data(item));
+        }
+        passed = check(converted == expected && in_arena, "Load into a memory arena") && passed;
+    }
+
+    std::pmr::monotonic_buffer_resource arena;
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>(), &arena);
+    rce.load_data("config_file.yaml");
+    return check(rce.get_data() == expected, "Editor store in a memory arena") && passed;
+}
+
+/**
+ * @brief test_columns filters the constraints with a ConstraintColumns table, and compares the selection
+ *        and an aggregate with a scan of the data.
+ */
+static bool test_columns()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    const auto data = rce.get_data();
+    const auto columns = rce.get_columns();
+
+    // Reference: the constraints on robot 1 with safe_distance + buffer < 0.2, and their mean vfi_gain
+    std::vector<std::string> expected;
+    double sum = 0.0;
+    for (const auto& item : data)
+    {
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            bool on_robot;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>)
+                on_robot = arg.robot_index == 1;
+            else
+                on_robot = arg.robot_index_one == 1 || arg.robot_index_two == 1;
+            if (on_robot && arg.safe_distance + arg.buffer < 0.2)
+            {
+                expected.push_back(arg.tag);
+                sum += arg.vfi_gain;
+            }
+        }, item);
+    }
+
+    auto mask = columns.select(ConstraintColumns::COLUMN::CLEARANCE, ConstraintColumns::COMPARISON::LESS, 0.2);
+    ConstraintColumns::mask_and(mask, columns.select_robot(1));
+    bool passed = check(columns.size() == data.size() && columns.get_tags(mask) == expected, "Columnar filter");
+    const double mean = columns.mean(ConstraintColumns::COLUMN::VFI_GAIN, mask);
+    return check(expected.empty() ? std::isnan(mean) : std::abs(mean - sum/static_cast<double>(expected.size())) < 1e-12,
+                 "Columnar aggregate") && passed;
+}
+
+/**
+ * @brief test_validation validates a valid and an invalid set of constraints, from the data and from the
+ *        columns, and checks the reported issues.
+ */
+static bool test_validation()
+{
+    VFIConfigurationFileYaml yaml;
+    yaml.load_data("config_file.yaml");
+    const bool zero_indexed = yaml.is_zero_indexed();
+
+    // Several copies of the file, so that the SIMD loop is used
+    std::vector<VFIConfigurationFile::Data> data;
+    for (int copy = 0; copy < 3; ++copy)
+        for (auto item : yaml.get_data())
+        {
+            std::visit([&](auto&& arg) {
+                arg.tag += "_" + std::to_string(copy);
+            }, item);
+            data.push_back(item);
+        }
+    bool passed = check(ConstraintValidation::validate(data, zero_indexed).is_valid(), "Validation of valid data");
+
+    std::visit([](auto&& arg) {
+        arg.safe_distance = -0.1;
+        arg.vfi_gain = std::numeric_limits<double>::infinity();
+    }, data[0]);
+    std::visit([](auto&& arg) {
+        arg.buffer = std::nan("");
+    }, data[5]);
+    std::get<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>(data[7]).joint_index_two = zero_indexed ? -1 : 0;
+
+    const auto report = ConstraintValidation::validate(data, zero_indexed);
+    const auto tag = [&](const std::size_t& i) {
+        return std::visit([](auto&& arg) {return arg.tag;}, data[i]);
+    };
+    using ISSUE = ConstraintValidation::ISSUE;
+    passed = check(report.violations.size() == 3 &&
+                   report.violations[0].tag == tag(0) &&
+                   report.violations[0].has(ISSUE::NEGATIVE_SAFE_DISTANCE) &&
+                   report.violations[0].has(ISSUE::NON_FINITE_VFI_GAIN) &&
+                   !report.violations[0].has(ISSUE::NEGATIVE_BUFFER) &&
+                   report.violations[1].tag == tag(5) &&
+                   report.violations[1].issues == static_cast<std::uint8_t>(ISSUE::NEGATIVE_BUFFER) &&
+                   report.violations[2].tag == tag(7) &&
+                   report.violations[2].issues == static_cast<std::uint8_t>(ISSUE::INVALID_INDEX),
+                   "Validation report") && passed;
+
+    ConstraintColumns columns;
+    columns.add_data(data);
+    const auto columns_report = ConstraintValidation::validate(columns, zero_indexed);
+    bool same = columns_report.violations.size() == report.violations.size();
+    for (std::size_t i = 0; same && i < report.violations.size(); ++i)
+        same = columns_report.violations[i].tag == report.violations[i].tag &&
+               columns_report.violations[i].issues == report.violations[i].issues;
+    return check(same, "Validation of columns") && passed;
+}
+
+/**
+ * @brief sorted_tags returns the tags of the constraints of a view, sorted.
+ */
+static std::vector<std::string> sorted_tags(const ConstraintView& view)
+{
+    std::vector<std::string> tags;
+    for (const auto& data : view)
+        tags.push_back(std::visit([](auto&& arg) {return arg.tag;}, data));
+    std::sort(tags.begin(), tags.end());
+    return tags;
+}
+
+/**
+ * @brief indices_match compares the secondary indices of the editor with a scan of get_data().
+ */
+static bool indices_match(RobotConstraintEditor& rce)
+{
+    bool match = true;
+    for (int robot = 0; robot < 4; ++robot)
+    {
+        std::vector<std::string> by_robot;
+        std::vector<std::string> by_joint;
+        for (const auto& data : rce.get_data())
+        {
+            std::visit([&](auto&& arg) {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                    if (arg.robot_index == robot)
+                        by_robot.push_back(arg.tag);
+                    if (arg.robot_index == robot && arg.joint_index == 1)
+                        by_joint.push_back(arg.tag);
+                } else {
+                    if (arg.robot_index_one == robot || arg.robot_index_two == robot)
+                        by_robot.push_back(arg.tag);
+                    if ((arg.robot_index_one == robot && arg.joint_index_one == 1) ||
+                        (arg.robot_index_two == robot && arg.joint_index_two == 1))
+                        by_joint.push_back(arg.tag);
+                }
+            }, data);
+        }
+        // get_data() is sorted by tag
+        match = match && sorted_tags(rce.get_data_by_robot(robot)) == by_robot &&
+                sorted_tags(rce.get_data_by_joint(robot, 1)) == by_joint;
+    }
+    std::size_t number_of_data = 0;
+    for (const auto& vfi_type : {"ENVIRONMENT_TO_ROBOT", "ROBOT_TO_ROBOT"})
+        number_of_data += rce.get_data_by_vfi_type(vfi_type).size();
+    return match && number_of_data == rce.get_data().size() &&
+           rce.get_data_by_direction("RESTRICTED_ZONE").size() + rce.get_data_by_direction("SAFE_ZONE").size() ==
+           rce.get_data().size();
+}
+
+/**
+ * @brief test_secondary_indices checks the indices by robot, joint, vfi_type and direction after additions,
+ *        removals, edits and replacements.
+ */
+static bool test_secondary_indices()
+{
+    VFIConfigurationFileYaml yaml;
+    yaml.load_data("config_file.yaml");
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    for (int copy = 0; copy < 10; ++copy)
+        for (auto item : yaml.get_data())
+        {
+            std::visit([&](auto&& arg) {
+                arg.tag += "_" + std::to_string(copy);
+            }, item);
+            rce.add_data(item);
+        }
+    bool passed = check(indices_match(rce), "Secondary indices after add_data");
+
+    // Remove some data, so that the store moves its last entries
+    for (int copy = 0; copy < 10; copy += 3)
+        rce.remove_data("C1_" + std::to_string(copy));
+    rce.edit_data("C3_1", "robot_index_two", 3);
+    rce.edit_data("C1_1", "joint_index", 2);
+    rce.edit_data("C3_4", RobotConstraintEditor::get_field_handle("direction"), std::string("SAFE_ZONE"));
+    rce.edit_data({{"C3_2", "robot_index_one", 0}, {"C3_2", "tag", std::string("C3_2b")}});
+    auto replacement = rce.get_data().front();
+    std::visit([](auto&& arg) {
+        arg.tag = "C2_5";
+    }, replacement);
+    rce.replace_data("C2_5", replacement);
+    return check(indices_match(rce) && rce.get_data_by_robot(3).size() > 0, "Secondary indices after edits") && passed;
+}
+
+/**
+ * @brief test_entity_index looks the constraints up by entity name, and renames an entity in all of them.
+ */
+static bool test_entity_index()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    bool passed = check(sorted_tags(rce.get_data_by_entity("line_1")) == std::vector<std::string>{"C3"} &&
+                        rce.get_data_by_entity("line_3").empty(), "Entity index");
+
+    rce.edit_data("C2", "cs_entity_one", std::vector<std::string>{"line_1"});
+    const std::size_t renamed = rce.rename_entity("line_1", "line_3");
+    return check(renamed == 2 && rce.rename_entity("line_1", "line_4") == 0 &&
+                 rce.get_data_by_entity("line_1").empty() &&
+                 sorted_tags(rce.get_data_by_entity("line_3")) == std::vector<std::string>{"C2", "C3"},
+                 "Rename entity") && passed;
+}
+
+/**
+ * @brief test_zero_copy_access checks take_data(), visit_data(), get_data_view() and find_data(), which do
+ *        not copy the data.
+ */
+static bool test_zero_copy_access()
+{
+    VFIConfigurationFileYaml yaml;
+    yaml.load_data("config_file.yaml");
+    const auto* first = yaml.view_data().data();
+    auto data = yaml.take_data();
+    bool passed = check(data.size() == 3 && data.data() == first && yaml.view_data().empty(), "Take data");
+
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    std::vector<std::string> visited;
+    rce.visit_data([&](const VFIConfigurationFile::Data& item) {
+        visited.push_back(std::visit([](auto&& arg) {return arg.tag;}, item));
+    });
+    std::vector<std::string> viewed;
+    for (const auto& item : rce.get_data_view())
+        viewed.push_back(std::visit([](auto&& arg) {return arg.tag;}, item));
+    const auto* c2 = rce.find_data("C2");
+    return check(visited == std::vector<std::string>{"C1", "C2", "C3"} && viewed == visited &&
+                 c2 && &rce.get_data("C2") == c2 && !rce.find_data("C4"), "Zero-copy access") && passed;
+}
+
+/**
+ * @brief test_move_semantics counts the allocations to check that load_data() and the rvalue overloads of
+ *        add_data() and replace_data() do not copy the strings of the data.
+ */
+static bool test_move_semantics()
+{
+    // The tags and the entity names do not fit in the small string buffer, so copying them allocates memory
+    const std::size_t size = 200;
+    std::vector<VFIConfigurationFile::Data> data;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA env_data;
+        env_data.vfi_type = "ENVIRONMENT_TO_ROBOT";
+        env_data.safe_distance = 0.1;
+        env_data.vfi_gain = 1.0;
+        env_data.direction = "RESTRICTED_ZONE";
+        env_data.tag = "constraint_with_a_long_tag_" + std::to_string(i);
+        env_data.cs_entity_environment = {"environment_entity_" + std::to_string(i % 7)};
+        env_data.cs_entity_robot = {"robot_entity_with_a_long_name"};
+        env_data.entity_environment_primitive_type = "LINE";
+        env_data.entity_robot_primitive_type = "POINT";
+        env_data.robot_index = 1;
+        env_data.joint_index = 1;
+        data.push_back(env_data);
+    }
+    // The tag, vfi_type, the two cs_entity lists and their names
+    const std::size_t strings_per_constraint = 6;
+    VFIConfigurationFileYaml().save_data(data, 1, false, "config_file_moves.yaml");
+
+    // Loading into the editor must only add the allocations of the store and of the indices to the parsing
+    std::size_t allocations = number_of_allocations;
+    VFIConfigurationFileYaml().load_data("config_file_moves.yaml");
+    const std::size_t parse_allocations = number_of_allocations - allocations;
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    allocations = number_of_allocations;
+    rce.load_data("config_file_moves.yaml");
+    const std::size_t load_allocations = number_of_allocations - allocations;
+    bool passed = check(rce.get_data_view().size() == size &&
+                        load_allocations < parse_allocations + size*strings_per_constraint,
+                        "Load without copying strings");
+
+    auto moved = data;
+    auto rce_moves = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    allocations = number_of_allocations;
+    rce_moves.add_data(std::move(moved));
+    const std::size_t add_allocations = number_of_allocations - allocations;
+    allocations = number_of_allocations;
+    rce_moves.replace_data("constraint_with_a_long_tag_0", data.front());
+    const std::size_t copy_replace_allocations = number_of_allocations - allocations;
+    auto replacement = data.front();
+    allocations = number_of_allocations;
+    rce_moves.replace_data("constraint_with_a_long_tag_0", std::move(replacement));
+    const std::size_t replace_allocations = number_of_allocations - allocations;
+    return check(add_allocations < size*strings_per_constraint &&
+                 replace_allocations + strings_per_constraint <= copy_replace_allocations &&
+                 rce_moves.get_data("constraint_with_a_long_tag_0") == data.front(), "Add and replace by moving") && passed;
+}
+
+/**
+ * @brief test_delta_save saves only the changes to a delta journal, and checks its replay, a partially
+ *        written entry and the compaction.
+ */
+static bool test_delta_save()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    rce.save_data("config_file_delta.yaml", 2, false);
+    const std::string base = read_file("config_file_delta.yaml");
+
+    rce.edit_data("C1", "vfi_gain", 2.5);
+    rce.remove_data("C2");
+    rce.edit_data("C3", "tag", std::string("C4"));
+    rce.save_changes("config_file_delta.yaml", 2, false);
+    bool passed = check(read_file("config_file_delta.yaml") == base && !rce.has_unsaved_changes() &&
+                        std::filesystem::exists("config_file_delta.yaml.delta"), "Delta save");
+
+    // A partially written entry at the end of the journal is ignored, and later entries are still applied
+    std::ofstream("config_file_delta.yaml.delta", std::ios::binary | std::ios::app) << "partial";
+    const std::string torn_journal = read_file("config_file_delta.yaml.delta");
+    auto reloaded = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    reloaded.load_data("config_file_delta.yaml");
+    passed = check(read_file("config_file_delta.yaml.delta") == torn_journal, "Load leaves the journal unchanged") &&
+             passed;
+    reloaded.edit_data("C1", "safe_distance", 0.25);
+    reloaded.save_changes("config_file_delta.yaml", 2, false);
+    rce.edit_data("C1", "safe_distance", 0.25);
+    auto replayed = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    replayed.load_data("config_file_delta.yaml");
+    passed = check(replayed.get_data() == rce.get_data() && !replayed.has_unsaved_changes(), "Delta replay") && passed;
+
+    replayed.set_compaction_threshold(0);
+    replayed.edit_data("C1", "buffer", 0.5);
+    replayed.save_changes("config_file_delta.yaml", 2, false);
+    auto compacted = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    compacted.load_data("config_file_delta.yaml");
+    return check(!std::filesystem::exists("config_file_delta.yaml.delta") &&
+                 compacted.get_data() == replayed.get_data(), "Delta compaction") && passed;
+}
+
+/**
+ * @brief test_write_ahead_journal records the edits in the write-ahead journal, and checks the recovery
+ *        from it and its compaction.
+ */
+static bool test_write_ahead_journal()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    rce.start_journal("config_file_wal.yaml", 2, false, std::chrono::milliseconds(1));
+    rce.edit_data("C1", "vfi_gain", 3.5);
+    rce.remove_data("C2");
+    auto data = rce.get_data("C3");
+    std::visit([](auto&& arg) {
+        arg.tag = "C5";
+    }, data);
+    rce.add_data(data);
+    rce.edit_data({{"C3", "tag", std::string("C2")}, {"C5", "tag", std::string("C3")}});
+    rce.flush_journal();
+
+    // Recovery, without stopping the journal
+    auto recovered = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    recovered.load_data("config_file_wal.yaml");
+    bool passed = check(recovered.get_data() == rce.get_data(), "Journal recovery");
+
+    // Exceeding the threshold saves a snapshot and starts a new journal
+    const std::string snapshot = read_file("config_file_wal.yaml");
+    rce.set_compaction_threshold(8);
+    for (int i = 0; i < 4; ++i)
+        rce.edit_data("C1", "safe_distance", 0.1*i);
+    rce.stop_journal();
+    auto compacted = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    compacted.load_data("config_file_wal.yaml");
+    return check(read_file("config_file_wal.yaml") != snapshot && compacted.get_data() == rce.get_data() &&
+                 !rce.is_journal_active(), "Journal compaction") && passed;
+}
+
+/**
+ * @brief test_undo_redo undoes and redoes every kind of edit, and checks the depth limit of the history.
+ */
+static bool test_undo_redo()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    const auto original = rce.get_data();
+
+    rce.edit_data("C1", "robot_index", 3);
+    rce.edit_data("C1", "tag", std::string("C4"));
+    auto data = rce.get_data("C3");
+    std::visit([](auto&& arg) {
+        arg.tag = "C5";
+    }, data);
+    rce.add_data(data);
+    rce.remove_data("C2");
+    rce.edit_data({{"C3", "tag", std::string("C2")}, {"C5", "tag", std::string("C3")}});
+    rce.rename_entity("line_1", "line_3");
+    const auto edited = rce.get_data();
+
+    std::size_t undone = 0;
+    while (rce.undo())
+        ++undone;
+    bool passed = check(undone == 6 && rce.get_data() == original && indices_match(rce) && rce.can_redo(), "Undo");
+    while (rce.redo());
+    passed = check(rce.get_data() == edited && indices_match(rce), "Redo") && passed;
+
+    rce.set_history_depth(2);
+    rce.undo();
+    rce.edit_data("C4", "tag", std::string("C1"));
+    undone = 0;
+    while (rce.undo())
+        ++undone;
+    return check(undone == 2 && rce.can_redo() && rce.has_tag("C4"), "Undo history depth") && passed;
+}
+
+/**
+ * @brief test_concurrent_snapshots edits the editor from several threads while other threads read
+ *        snapshots and query the secondary indices. Each writer edits a pair of constraints with atomic
+ *        batches, so every snapshot must see both constraints of a pair with the same gain. Run it with
+ *        ThreadSanitizer to check the races.
+ */
+static bool test_concurrent_snapshots()
+{
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    const std::size_t number_of_writers = 2;
+    const int number_of_edits = 500;
+    const auto base = rce.get_data("C1");
+    for (std::size_t w = 0; w < number_of_writers; ++w)
+        for (const auto& suffix : {"_a", "_b"})
+        {
+            auto data = base;
+            std::visit([&](auto&& arg) {
+                arg.tag = "W" + std::to_string(w) + suffix;
+            }, data);
+            rce.add_data(std::move(data));
+        }
+
+    auto gain = [](const VFIConfigurationFile::Data* data) {
+        return std::visit([](auto&& arg) {return arg.vfi_gain;}, *data);
+    };
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < 2; ++r)
+        readers.emplace_back([&]() {
+            std::uint64_t last_version = 0;
+            while (!done)
+            {
+                const auto snapshot = rce.get_snapshot();
+                bool ok = snapshot.get_version() >= last_version && snapshot.get_data().size() == snapshot.size();
+                for (std::size_t w = 0; w < number_of_writers; ++w)
+                {
+                    const auto* a = snapshot.find_data("W" + std::to_string(w) + "_a");
+                    const auto* b = snapshot.find_data("W" + std::to_string(w) + "_b");
+                    ok = ok && a && b && gain(a) == gain(b);
+                }
+                last_version = snapshot.get_version();
+                if (!ok)
+                    consistent = false;
+            }
+        });
+    // The index queries lock the editor too. Their views point into the editor, which the writers modify,
+    // so only their sizes are read. C1 is never modified.
+    readers.emplace_back([&]() {
+        while (!done)
+        {
+            const bool found = rce.get_data_by_robot(1).size() > 0 && rce.get_data_by_joint(1, 1).size() > 0 &&
+                               rce.get_data_by_vfi_type("ENVIRONMENT_TO_ROBOT").size() > 0 &&
+                               rce.get_data_by_direction("RESTRICTED_ZONE").size() > 0 &&
+                               rce.get_data_by_entity("Cylinder_1").size() > 0;
+            if (!found)
+                consistent = false;
+        }
+    });
+    std::vector<std::thread> writers;
+    for (std::size_t w = 0; w < number_of_writers; ++w)
+        writers.emplace_back([&, w]() {
+            const std::string prefix = "W" + std::to_string(w);
+            for (int i = 1; i <= number_of_edits; ++i)
+            {
+                rce.edit_data({{prefix + "_a", "vfi_gain", double(i)}, {prefix + "_b", "vfi_gain", double(i)}});
+                auto extra = base;
+                std::visit([&](auto&& arg) {
+                    arg.tag = prefix + "_extra";
+                }, extra);
+                rce.add_data(std::move(extra));
+                rce.remove_data(prefix + "_extra");
+            }
+        });
+    for (auto& writer : writers)
+        writer.join();
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+    const auto snapshot = rce.get_snapshot();
+    return check(consistent && snapshot.size() == 3 + 2*number_of_writers && snapshot.get_data() == rce.get_data(),
+                 "Concurrent edits and snapshots");
+}
+
+/**
+ * @brief test_change_notifications subscribes to the changes of the editor, with and without coalescing,
+ *        and checks the delivered events.
+ */
+static bool test_change_notifications()
+{
+    using ChangeEvent = RobotConstraintEditor::ChangeEvent;
+    using FieldValue = RobotConstraintEditor::FieldValue;
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data("config_file.yaml");
+    std::vector<ChangeEvent> events;
+    std::vector<ChangeEvent> coalesced;
+    const auto id = rce.subscribe([&](const std::vector<ChangeEvent>& batch) {
+        events.insert(events.end(), batch.begin(), batch.end());
+    });
+    rce.subscribe([&](const std::vector<ChangeEvent>& batch) {
+        coalesced = batch;
+    }, true);
+
+    rce.edit_data("C1", "robot_index", 3);
+    bool passed = check(events.size() == 1 && events[0].type == ChangeEvent::TYPE::EDITED && events[0].tag == "C1" &&
+                        events[0].key == "robot_index" && events[0].old_value == FieldValue(1) &&
+                        events[0].new_value == FieldValue(3), "Edit event");
+
+    events.clear();
+    rce.pause_notifications();
+    rce.edit_data("C2", "vfi_gain", 2.0);
+    rce.edit_data("C2", "tag", std::string("C4"));
+    rce.edit_data("C4", "vfi_gain", 3.0);
+    auto data = rce.get_data("C3");
+    std::visit([](auto&& arg) {
+        arg.tag = "C5";
+    }, data);
+    rce.add_data(data);
+    rce.edit_data("C5", "buffer", 1.0);
+    rce.remove_data("C5");
+    rce.remove_data("C3");
+    // The other subscriber gets each modification, but the coalesced batch is held until resume
+    const bool held = events.size() == 7 && coalesced.size() == 1;
+    rce.resume_notifications();
+    passed = check(held && coalesced.size() == 3 &&
+                   coalesced[0].type == ChangeEvent::TYPE::REMOVED && coalesced[0].tag == "C3" &&
+                   coalesced[1].key == "tag" && coalesced[1].tag == "C4" && coalesced[1].old_value == FieldValue("C2") &&
+                   coalesced[2].key == "vfi_gain" && coalesced[2].tag == "C4" && coalesced[2].new_value == FieldValue(3.0),
+                   "Coalesced events") && passed;
+
+    events.clear();
+    rce.unsubscribe(id);
+    rce.undo();
+    passed = check(events.empty() && coalesced.size() == 1 && coalesced[0].type == ChangeEvent::TYPE::ADDED &&
+                   coalesced[0].tag == "C3", "Undo events and unsubscribe") && passed;
+
+    // A failing callback does not stop the delivery, even if it does not throw a std::exception
+    rce.subscribe([](const std::vector<ChangeEvent>&) {
+        throw 1;
+    });
+    rce.edit_data("C1", "vfi_gain", 4.0);
+    return check(coalesced.size() == 1 && coalesced[0].tag == "C1" && coalesced[0].new_value == FieldValue(4.0),
+                 "Failing callback") && passed;
+}
+
+/**
+ * @brief test_hot_reload reloads a file saved by another editor, and checks that only the differences are
+ *        applied, both by reload_data() and by the file watcher, and only to the constraints of the file.
+ */
+static bool test_hot_reload()
+{
+    const std::string file = "config_file_reload.yaml";
+    auto external = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    external.load_data("config_file.yaml");
+    external.save_data(file, 2, false);
+    auto rce = RobotConstraintEditor(std::make_shared<VFIConfigurationFileYaml>());
+    rce.load_data(file);
+    std::size_t number_of_events = 0;
+    rce.subscribe([&](const std::vector<RobotConstraintEditor::ChangeEvent>& events) {
+        number_of_events += events.size();
+    });
+    bool passed = check(rce.reload_data(file) == 0 && number_of_events == 0, "Reload unchanged file");
+
+    // Only the differences are applied: one edit, one removal and one addition
+    external.edit_data("C1", "vfi_gain", 4.5);
+    external.remove_data("C2");
+    auto data = external.get_data("C3");
+    std::visit([](auto&& arg) {
+        arg.tag = "C5";
+    }, data);
+    external.add_data(data);
+    external.save_data(file, 2, false);
+    passed = check(rce.reload_data(file) == 3 && rce.get_data() == external.get_data() &&
+                   !rce.has_unsaved_changes() && rce.reload_data(file) == 0, "Reload differences") && passed;
+
+    // A constraint that does not come from the file is not replaced by a constraint of the file with its tag
+    auto added = external.get_data("C1");
+    std::visit([](auto&& arg) {
+        arg.tag = "C7";
+        arg.vfi_gain = 6.5;
+    }, added);
+    rce.add_data(added);
+    std::visit([](auto&& arg) {
+        arg.vfi_gain = 7.5;
+    }, added);
+    external.add_data(added);
+    external.save_data(file, 2, false);
+    bool failed = false;
+    try {
+        rce.reload_data(file);
+    } catch (const std::runtime_error& e) {
+        failed = std::string(e.what()).find("Tag 'C7'") != std::string::npos;
+    }
+    const double gain = std::visit([](auto&& arg) {return arg.vfi_gain;}, rce.get_data("C7"));
+    external.remove_data("C7");
+    external.save_data(file, 2, false);
+    rce.remove_data("C7");
+    passed = check(failed && gain == 6.5 && rce.reload_data(file) == 0 && rce.get_data() == external.get_data(),
+                   "Reload does not replace the constraints of others") && passed;
+
+    rce.start_watching(file, std::chrono::milliseconds(20));
+    external.edit_data("C5", "vfi_gain", 5.5);
+    external.save_data(file, 2, false);
+    for (int i = 0; i < 500 && rce.get_data() != external.get_data(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const bool is_reloaded = rce.get_data() == external.get_data();
+    rce.stop_watching();
+    return check(is_reloaded && !rce.is_watching(), "Hot reload") && passed;
+}
+
+/**
+ * @brief test_parse_cache loads files through a ParseCache, and checks the hits, a damaged entry and the
+ *        eviction of the least recently used entry.
+ */
+static bool test_parse_cache()
+{
+    const std::string directory = "parse_cache";
+    auto cache = std::make_shared<ParseCache>(directory);
+    cache->clear();
+    VFIConfigurationFileYaml parsed;
+    parsed.load_data("config_file.yaml");
+    VFIConfigurationFileYaml yaml;
+    yaml.set_parse_cache(cache);
+    yaml.load_data("config_file.yaml");
+    auto cached = yaml.new_instance();
+    cached->load_data("config_file.yaml");
+    bool passed = check(cached->get_data() == parsed.get_data() &&
+                        cached->get_vfi_file_version() == parsed.get_vfi_file_version() &&
+                        cached->is_zero_indexed() == parsed.is_zero_indexed() &&
+                        cache->get_number_of_misses() == 1 && cache->get_number_of_hits() == 1, "Parse cache hit");
+
+    // A damaged entry is parsed again
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+        std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "damaged";
+    yaml.load_data("config_file.yaml");
+    passed = check(yaml.get_data() == parsed.get_data() && cache->get_number_of_misses() == 2,
+                   "Parse cache damaged entry") && passed;
+
+    // Two files with different contents
+    auto data = parsed.get_data();
+    parsed.save_data(data, parsed.get_vfi_file_version(), parsed.is_zero_indexed(), "config_file_cache_a.yaml");
+    std::visit([](auto&& arg) {
+        arg.vfi_gain = 2.0;
+    }, data.front());
+    parsed.save_data(data, parsed.get_vfi_file_version(), parsed.is_zero_indexed(), "config_file_cache_b.yaml");
+
+    // With room for two entries, the third one removes the least recently used one: b, since a was read again
+    cache->clear();
+    auto small_cache = std::make_shared<ParseCache>(directory, 1 << 20, 2);
+    yaml.set_parse_cache(small_cache);
+    yaml.load_data("config_file_cache_a.yaml");
+    yaml.load_data("config_file_cache_b.yaml");
+    yaml.load_data("config_file_cache_a.yaml");
+    yaml.load_data("config_file.yaml");
+    const std::size_t number_of_hits = small_cache->get_number_of_hits();
+    yaml.load_data("config_file_cache_a.yaml");
+    const bool is_a_kept = small_cache->get_number_of_hits() == number_of_hits + 1;
+    yaml.load_data("config_file_cache_b.yaml");
+    const bool is_b_removed = small_cache->get_number_of_hits() == number_of_hits + 1;
+    const auto number_of_entries = std::distance(std::filesystem::directory_iterator(directory),
+                                                 std::filesystem::directory_iterator());
+    return check(is_a_kept && is_b_removed && number_of_entries == 2 && small_cache->get_number_of_misses() == 4 &&
+                 yaml.get_data() == data, "Parse cache evicts the least recently used entry") && passed;
+}
 
 int main()
 {
@@ -48,6 +1160,29 @@ int main()
 
     //------------------------------
 
+    bool passed = test_yaml_binary_round_trip();
+    passed = test_streaming_load() && passed;
+    passed = test_yaml_double_round_trip() && passed;
+    passed = test_atomic_save() && passed;
+    passed = test_parallel_dom_load() && passed;
+    passed = test_interned_data() && passed;
+    passed = test_store_removal() && passed;
+    passed = test_batch_edit() && passed;
+    passed = test_multi_file_load() && passed;
+    passed = test_pmr_data() && passed;
+    passed = test_columns() && passed;
+    passed = test_validation() && passed;
+    passed = test_secondary_indices() && passed;
+    passed = test_entity_index() && passed;
+    passed = test_zero_copy_access() && passed;
+    passed = test_move_semantics() && passed;
+    passed = test_delta_save() && passed;
+    passed = test_write_ahead_journal() && passed;
+    passed = test_undo_redo() && passed;
+    passed = test_concurrent_snapshots() && passed;
+    passed = test_change_notifications() && passed;
+    passed = test_hot_reload() && passed;
+    passed = test_parse_cache() && passed;
 
-    return 0;
+    return passed ? 0 : 1;
 }
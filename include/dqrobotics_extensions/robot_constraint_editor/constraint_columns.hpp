@@ -0,0 +1,120 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The ConstraintColumns class is a columnar (struct-of-arrays) snapshot of a constraint set,
+ *        for bulk numeric queries. Each numeric field is kept in a contiguous array, so the filter and
+ *        aggregate kernels are simple loops over arrays that the compiler can vectorize.
+ *        The fields of an ENVIRONMENT_TO_ROBOT constraint use the "one" columns, and its "two"
+ *        columns are no_index.
+ *
+ * Example (tags of the constraints with safe_distance + buffer < 0.1 on robot 2):
+ *     const auto columns = editor.get_columns();
+ *     auto mask = columns.select(ConstraintColumns::COLUMN::CLEARANCE, ConstraintColumns::COMPARISON::LESS, 0.1);
+ *     ConstraintColumns::mask_and(mask, columns.select_robot(2));
+ *     const auto tags = columns.get_tags(mask);
+ */
+class ConstraintColumns
+{
+public:
+    enum class TYPE : std::uint8_t{
+        ENVIRONMENT_TO_ROBOT,
+        ROBOT_TO_ROBOT
+    };
+
+    /**
+     * @brief The COLUMN enum selects a numeric column. CLEARANCE is safe_distance + buffer.
+     */
+    enum class COLUMN{
+        SAFE_DISTANCE,
+        BUFFER,
+        VFI_GAIN,
+        CLEARANCE
+    };
+
+    enum class COMPARISON{
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL
+    };
+
+    /**
+     * @brief Mask has one element per row, 1 if the row is selected and 0 otherwise.
+     */
+    using Mask = std::vector<std::uint8_t>;
+
+    static constexpr std::int32_t no_index = std::numeric_limits<std::int32_t>::min();
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+
+public:
+    ConstraintColumns();
+
+    void reserve(const std::size_t& size);
+    void clear();
+    void add_data(const VFIConfigurationFile::Data& data);
+    void add_data(const std::vector<VFIConfigurationFile::Data>& vector_data);
+
+    std::size_t size() const;
+    bool empty() const;
+
+    const std::vector<TYPE>& get_types() const;
+    const std::vector<double>& get_safe_distances() const;
+    const std::vector<double>& get_buffers() const;
+    const std::vector<double>& get_vfi_gains() const;
+    const std::vector<std::int32_t>& get_robot_indexes_one() const;
+    const std::vector<std::int32_t>& get_robot_indexes_two() const;
+    const std::vector<std::int32_t>& get_joint_indexes_one() const;
+    const std::vector<std::int32_t>& get_joint_indexes_two() const;
+    const std::vector<std::string>& get_tags() const;
+    std::vector<std::string> get_tags(const Mask& mask) const;
+
+    // Filter kernels
+    Mask select(const COLUMN& column, const COMPARISON& comparison, const double& value) const;
+    Mask select_type(const TYPE& type) const;
+    Mask select_robot(const std::int32_t& robot_index) const;
+    Mask select_joint(const std::int32_t& robot_index, const std::int32_t& joint_index) const;
+    static void mask_and(Mask& mask, const Mask& other);
+    static void mask_or(Mask& mask, const Mask& other);
+
+    // Aggregate kernels
+    static std::size_t count(const Mask& mask);
+    double sum(const COLUMN& column, const Mask& mask) const;
+    double min(const COLUMN& column, const Mask& mask) const;
+    double max(const COLUMN& column, const Mask& mask) const;
+    double mean(const COLUMN& column, const Mask& mask) const;
+};
+}
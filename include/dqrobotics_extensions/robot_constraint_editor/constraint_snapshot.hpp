@@ -0,0 +1,63 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+class ConstraintSnapshotBuilder;
+
+/**
+ * @brief The ConstraintSnapshot class is an immutable version of the constraints of a RobotConstraintEditor,
+ *        returned by RobotConstraintEditor::get_snapshot(). It can be read from any thread while the editor
+ *        is being modified, and copying it is cheap. Consecutive snapshots share the chunks of constraints
+ *        that did not change between them.
+ *
+ * Example (validation in a background thread):
+ *     const auto snapshot = editor.get_snapshot();
+ *     const auto report = ConstraintValidation::validate(snapshot.get_data(), true);
+ */
+class ConstraintSnapshot
+{
+private:
+    friend class ConstraintSnapshotBuilder;
+    class Impl;
+    std::shared_ptr<const Impl> impl_;
+
+public:
+    ConstraintSnapshot();
+
+    std::uint64_t get_version() const;
+    std::size_t size() const;
+    bool empty() const;
+    std::vector<VFIConfigurationFile::Data> get_data() const;
+    const VFIConfigurationFile::Data* find_data(const std::string& tag) const;
+    void visit_data(const std::function<void(const VFIConfigurationFile::Data&)>& visitor) const;
+};
+}
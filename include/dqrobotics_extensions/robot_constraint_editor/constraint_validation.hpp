@@ -0,0 +1,95 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_columns.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * Sanity checks of the numeric fields of whole constraint sets.
+ *
+ * The checks run on batches of rows stored as arrays, with SSE2 instructions on x86-64 (and a scalar
+ * loop elsewhere), and only the offending constraints are reported. A clean set costs one pass
+ * over its numbers.
+ *
+ * Example:
+ *     const auto report = ConstraintValidation::validate(yaml.get_data(), yaml.is_zero_indexed());
+ *     if (!report.is_valid())
+ *         std::cerr << report.to_string();
+ */
+namespace ConstraintValidation
+{
+/**
+ * @brief The ISSUE enum lists the problems found by validate(). The values are bit flags.
+ *        NEGATIVE_SAFE_DISTANCE and NEGATIVE_BUFFER are also reported for NaN values.
+ *        INVALID_INDEX is reported for robot or joint indexes below 0 (zero-indexed data) or
+ *        below 1 (one-indexed data).
+ */
+enum class ISSUE : std::uint8_t{
+    NEGATIVE_SAFE_DISTANCE = 1,
+    NEGATIVE_BUFFER = 2,
+    NON_FINITE_VFI_GAIN = 4,
+    INVALID_INDEX = 8
+};
+
+struct Violation{
+    std::string tag;
+    std::uint8_t issues;  // Combination of ISSUE flags
+
+    bool has(const ISSUE& issue) const
+    {
+        return (issues & static_cast<std::uint8_t>(issue)) != 0;
+    }
+};
+
+struct Report{
+    std::size_t number_of_constraints = 0;
+    std::vector<Violation> violations;  // In the order of the constraint set
+
+    bool is_valid() const
+    {
+        return violations.empty();
+    }
+
+    std::string to_string() const;
+};
+
+/**
+ * @brief get_issue_names returns the names of the issues of a combination of ISSUE flags, separated
+ *        by commas.
+ */
+std::string get_issue_names(const std::uint8_t& issues);
+
+Report validate(const std::vector<VFIConfigurationFile::Data>& data, const bool& zero_indexed);
+Report validate(const std::size_t& size,
+                const std::function<const VFIConfigurationFile::Data&(const std::size_t&)>& get_item,
+                const bool& zero_indexed);
+Report validate(const ConstraintColumns& columns, const bool& zero_indexed);
+}
+}
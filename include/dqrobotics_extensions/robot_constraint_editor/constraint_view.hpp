@@ -0,0 +1,89 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The ConstraintView class is a non-owning, read-only range of constraints stored elsewhere
+ *        (e.g. the result of a RobotConstraintEditor query). It does not copy the constraints.
+ *        A view is invalidated by any modification of the object that returned it.
+ *
+ * Example:
+ *     for (const auto& data : editor.get_data_by_robot(2))
+ *         std::visit([](auto&& arg) { std::cout << arg.tag << std::endl; }, data);
+ */
+class ConstraintView
+{
+public:
+    class const_iterator
+    {
+        const VFIConfigurationFile::Data* entries_ = nullptr;
+        const std::uint32_t* position_ = nullptr;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = VFIConfigurationFile::Data;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const VFIConfigurationFile::Data*;
+        using reference = const VFIConfigurationFile::Data&;
+
+        const_iterator() = default;
+        const_iterator(const VFIConfigurationFile::Data* entries, const std::uint32_t* position)
+            : entries_(entries), position_(position) {}
+
+        reference operator*() const {return entries_[*position_];}
+        pointer operator->() const {return &entries_[*position_];}
+        const_iterator& operator++() {++position_; return *this;}
+        const_iterator operator++(int) {const_iterator it = *this; ++position_; return it;}
+        bool operator==(const const_iterator& other) const {return position_ == other.position_;}
+        bool operator!=(const const_iterator& other) const {return position_ != other.position_;}
+    };
+
+private:
+    const VFIConfigurationFile::Data* entries_ = nullptr;
+    const std::uint32_t* positions_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    ConstraintView() = default;
+    /**
+     * @brief ConstraintView ctor of the class.
+     * @param entries The array that holds the constraints.
+     * @param positions The positions in entries of the constraints of the view, in the order of the view.
+     * @param size The number of positions.
+     */
+    ConstraintView(const VFIConfigurationFile::Data* entries, const std::uint32_t* positions, const std::size_t& size)
+        : entries_(entries), positions_(positions), size_(size) {}
+
+    const_iterator begin() const {return const_iterator(entries_, positions_);}
+    const_iterator end() const {return const_iterator(entries_, positions_ + size_);}
+    std::size_t size() const {return size_;}
+    bool empty() const {return size_ == 0;}
+    const VFIConfigurationFile::Data& operator[](const std::size_t& i) const {return entries_[positions_[i]];}
+};
+}
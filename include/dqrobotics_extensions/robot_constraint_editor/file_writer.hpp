@@ -0,0 +1,80 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <memory>
+#include <string>
+
+namespace DQ_robotics_extensions
+{
+class FileWriter
+{
+public:
+    /**
+     * @brief The SAVE_MODE enum defines how a file is replaced.
+     *        IN_PLACE truncates the target file and writes into it.
+     *        ATOMIC writes a sibling temporary file and renames it over the target file. A crash
+     *        during the save leaves either the old or the new file, never a partial one.
+     *        APPEND writes at the end of the target file, which is created if needed. discard()
+     *        truncates the file back to its size before open(). It is meant for journals.
+     */
+    enum class SAVE_MODE{
+        IN_PLACE,
+        ATOMIC,
+        APPEND
+    };
+
+    /**
+     * @brief The SYNC_POLICY enum defines when the saved files are flushed to the storage device.
+     *        NO_SYNC never calls fsync. It is the default, as in the plain file writes of the previous versions.
+     *        SYNC_EACH_FILE calls fsync on each file (and on its directory in the ATOMIC mode) before
+     *        commit() returns.
+     *        DEFERRED_SYNC skips fsync in commit() and keeps track of the saved files. They are flushed
+     *        by sync_pending(), which syncs each directory only once. This is meant for bulk exports.
+     */
+    enum class SYNC_POLICY{
+        NO_SYNC,
+        SYNC_EACH_FILE,
+        DEFERRED_SYNC
+    };
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+
+public:
+    explicit FileWriter(const SAVE_MODE& save_mode = SAVE_MODE::IN_PLACE,
+                        const SYNC_POLICY& sync_policy = SYNC_POLICY::NO_SYNC);
+
+    void set_save_mode(const SAVE_MODE& save_mode);
+    SAVE_MODE get_save_mode() const;
+    void set_sync_policy(const SYNC_POLICY& sync_policy);
+    SYNC_POLICY get_sync_policy() const;
+
+    void open(const std::string& path);
+    void write(const char* data, const std::size_t& size);
+    void commit();
+    void discard();
+    void sync_pending();
+};
+}
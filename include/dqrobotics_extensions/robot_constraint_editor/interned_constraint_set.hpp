@@ -0,0 +1,66 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/symbol_table.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The InternedConstraintSet class stores constraints in a compact form. The repeated strings
+ *        (vfi_type, direction, primitive types and entity names) are replaced by the Ids of a
+ *        SymbolTable, which can be shared by several sets. The numbers are kept in fixed-width
+ *        records, and all the entity lists share a single Id array. Only the tags, which are unique,
+ *        are stored as strings.
+ *        The set is append-only. Use get_data() to obtain the regular VFIConfigurationFile::Data.
+ */
+class InternedConstraintSet
+{
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+
+public:
+    InternedConstraintSet();
+    explicit InternedConstraintSet(const std::shared_ptr<SymbolTable>& symbols);
+
+    void reserve(const std::size_t& size);
+    void clear();
+    void add_data(const VFIConfigurationFile::Data& data);
+    void add_data(const std::vector<VFIConfigurationFile::Data>& vector_data);
+
+    std::size_t size() const;
+    bool empty() const;
+    const std::string& get_tag(const std::size_t& index) const;
+    VFIConfigurationFile::Data get_data(const std::size_t& index) const;
+    void get_data(const std::size_t& index, VFIConfigurationFile::Data& data) const;
+    std::vector<VFIConfigurationFile::Data> get_data() const;
+
+    std::shared_ptr<SymbolTable> get_symbols() const;
+    std::size_t memory_usage() const;
+};
+}
@@ -0,0 +1,78 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The ParseCache class keeps the parsed data of configuration files in a directory, so that loading
+ *        an unchanged file again (in the same or in another process) reads a compact binary entry instead
+ *        of parsing the file. The entries are keyed by a digest of the file content and are written in the
+ *        layout of vfi_binary_format.hpp. See VFIConfigurationFileYaml::set_parse_cache().
+ *
+ *        Several processes (and threads) can share a directory: the entries are written to a temporary
+ *        file and renamed, and the entries that fail validation are parsed again. The least recently used
+ *        entries are removed when the cache exceeds its size limits. A new version of the binary layout or
+ *        of the cache keys uses new entry names, so the old entries are never read and are removed first.
+ */
+class ParseCache
+{
+public:
+    /**
+     * @brief Parse is the function that parses a file on a cache miss. It gets the data, the
+     *        vfi_file_version and the zero_indexed flag of the file.
+     */
+    using Parse = std::function<void(std::vector<VFIConfigurationFile::Data>& data,
+                                     int& vfi_file_version,
+                                     bool& zero_indexed)>;
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+
+public:
+    explicit ParseCache(const std::string& directory,
+                        const std::uint64_t& max_size = std::uint64_t(256) << 20,
+                        const std::size_t& max_number_of_entries = 1024);
+
+    bool load(const std::string& config_file,
+              const Parse& parse,
+              std::vector<VFIConfigurationFile::Data>& data,
+              int& vfi_file_version,
+              bool& zero_indexed);
+    void clear();
+
+    std::string get_directory() const;
+    std::uint64_t get_max_size() const;
+    std::size_t get_max_number_of_entries() const;
+    std::size_t get_number_of_hits() const;
+    std::size_t get_number_of_misses() const;
+};
+}
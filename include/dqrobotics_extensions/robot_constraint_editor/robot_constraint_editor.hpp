@@ -22,9 +22,19 @@
 */
 
 #pragma once
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <string>
+#include <variant>
 #include <vector>
 #include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/interned_constraint_set.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_columns.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_validation.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_view.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_snapshot.hpp>
 
 
 namespace DQ_robotics_extensions
@@ -32,27 +42,135 @@ namespace DQ_robotics_extensions
 
 class RobotConstraintEditor
 {
+public:
+    /**
+     * @brief FieldValue is the new value of a field in an EditOperation.
+     */
+    using FieldValue = std::variant<int, double, std::string, std::vector<std::string>>;
+
+    /**
+     * @brief The EditOperation struct describes the change of one field of a tagged data.
+     *        See edit_data(const std::vector<EditOperation>&).
+     */
+    struct EditOperation{
+        std::string tag;
+        std::string key;
+        FieldValue value;
+    };
+
+    /**
+     * @brief The ChangeEvent struct describes one change of the data, as reported to the subscribers
+     *        (see subscribe()). A rename is an EDITED event of the "tag" key, and the other events of the
+     *        constraint use the new tag.
+     */
+    struct ChangeEvent{
+        enum class TYPE{
+            ADDED,
+            REMOVED,
+            EDITED
+        };
+        TYPE type;
+        std::string tag;
+        std::string key;       // Only for EDITED
+        FieldValue old_value;  // Only for EDITED
+        FieldValue new_value;  // Only for EDITED
+    };
+
+    using ChangeCallback = std::function<void(const std::vector<ChangeEvent>&)>;
+
+    /**
+     * @brief The FieldHandle class is a key resolved in advance by get_field_handle(). Editing the data
+     *        through a handle does not compare any strings, which is useful in loops that edit many tags.
+     */
+    class FieldHandle{
+    private:
+        friend class RobotConstraintEditor;
+        std::string key_;
+        std::size_t environment_to_robot_index_;
+        std::size_t robot_to_robot_index_;
+        bool is_tag_;
+        bool is_indexed_;  // True if the field is used by the secondary indices
+    public:
+        const std::string& get_key() const {return key_;}
+    };
+
 private:
     class Impl;
     std::shared_ptr<Impl> impl_;
 
 public:
     RobotConstraintEditor(const std::shared_ptr<VFIConfigurationFile>& interface);
+    RobotConstraintEditor(const std::shared_ptr<VFIConfigurationFile>& interface,
+                          std::pmr::memory_resource* memory_resource);
 
     void load_data(const std::string& config_file);
+    void load_data(const std::vector<std::string>& config_files, const std::size_t& number_of_threads = 0);
     void add_data(const std::vector<VFIConfigurationFile::Data>& vector_data);
+    void add_data(std::vector<VFIConfigurationFile::Data>&& vector_data);
     void add_data(const VFIConfigurationFile::Data& data);
+    void add_data(VFIConfigurationFile::Data&& data);
+    void add_data(const InternedConstraintSet& interned_data);
     void remove_data(const std::string& tag);
     void replace_data(const std::string& tag, const VFIConfigurationFile::Data& data);
+    void replace_data(const std::string& tag, VFIConfigurationFile::Data&& data);
     void save_data(const std::string& path_config_file,
                    const int& vfi_file_version,
                    const bool& zero_indexed);
+    void save_changes(const std::string& path_config_file,
+                      const int& vfi_file_version,
+                      const bool& zero_indexed);
+    void set_compaction_threshold(const std::size_t& number_of_entries);
+    std::size_t get_compaction_threshold() const;
+    bool has_unsaved_changes() const;
+    void start_journal(const std::string& path_config_file,
+                       const int& vfi_file_version,
+                       const bool& zero_indexed,
+                       const std::chrono::microseconds& commit_interval = std::chrono::milliseconds(10));
+    void flush_journal();
+    void stop_journal();
+    bool is_journal_active() const;
+    std::size_t reload_data(const std::string& config_file);
+    void start_watching(const std::string& config_file,
+                        const std::chrono::milliseconds& debounce_interval = std::chrono::milliseconds(100));
+    void stop_watching();
+    bool is_watching() const;
+    bool undo();
+    bool redo();
+    bool can_undo() const;
+    bool can_redo() const;
+    void set_history_depth(const std::size_t& depth);
+    std::size_t get_history_depth() const;
+    void clear_history();
+    std::size_t subscribe(const ChangeCallback& callback, const bool& coalesce = false);
+    bool unsubscribe(const std::size_t& id);
+    void pause_notifications();
+    void resume_notifications();
 
 
     template<typename T>
     void edit_data(const std::string& tag, const std::string& key, const T& value);
+    void edit_data(const std::vector<EditOperation>& edits);
+    template<typename T>
+    void edit_data(const std::string& tag, const FieldHandle& field, const T& value);
+    static FieldHandle get_field_handle(const std::string& key);
+    std::size_t rename_entity(const std::string& old_entity, const std::string& new_entity);
 
 
     std::vector<VFIConfigurationFile::Data> get_data();
+    const VFIConfigurationFile::Data& get_data(const std::string& tag) const;
+    const VFIConfigurationFile::Data* find_data(const std::string& tag) const;
+    ConstraintView get_data_view() const;
+    void visit_data(const std::function<void(const VFIConfigurationFile::Data&)>& visitor) const;
+    InternedConstraintSet get_interned_data(const std::shared_ptr<SymbolTable>& symbols = nullptr) const;
+    ConstraintColumns get_columns() const;
+    ConstraintValidation::Report validate_data(const bool& zero_indexed = true) const;
+    ConstraintSnapshot get_snapshot() const;
+
+    ConstraintView get_data_by_robot(const int& robot_index) const;
+    ConstraintView get_data_by_joint(const int& robot_index, const int& joint_index) const;
+    ConstraintView get_data_by_vfi_type(const std::string& vfi_type) const;
+    ConstraintView get_data_by_direction(const std::string& direction) const;
+    ConstraintView get_data_by_entity(const std::string& entity) const;
+    bool has_tag(const std::string& tag) const;
 };
 }
@@ -0,0 +1,58 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The SymbolTable class is a pool of strings. Each distinct string is stored once, and it is
+ *        identified by a compact integer Id. The Ids are given in insertion order, starting at zero.
+ *        The strings are never removed, so the Ids and the references returned by get() stay valid
+ *        while the table exists.
+ */
+class SymbolTable
+{
+public:
+    using Id = std::uint32_t;
+    static constexpr Id npos = std::numeric_limits<Id>::max();
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+
+public:
+    SymbolTable();
+
+    Id intern(const std::string_view& value);
+    Id find(const std::string_view& value) const;
+    const std::string& get(const Id& id) const;
+    std::size_t size() const;
+    std::size_t memory_usage() const;
+};
+}
@@ -0,0 +1,130 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * Layout of the binary constraint files written by VFIConfigurationFileBinary.
+ *
+ *  [Header]
+ *  [StringSlice x string_count]   offset and length of each interned string
+ *  [string bytes]                 string_bytes_size bytes, not null-terminated
+ *  [uint32_t x entity_id_count]   string ids of the cs_entity_* lists
+ *  [Record x record_count]        one fixed-width record per constraint
+ *
+ * Every section starts at a multiple of 8 bytes. All the strings (types, directions, tags and
+ * entity names) are interned in the string table and referenced by their index.
+ * The integers and doubles are stored in the byte order of the machine that wrote the file, which
+ * is recorded in Header::byte_order.
+ */
+namespace VFIBinaryFormat
+{
+constexpr char MAGIC[4] = {'V', 'F', 'I', 'B'};
+constexpr std::uint32_t FORMAT_VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+enum class RECORD_TYPE : std::uint32_t{
+    ENVIRONMENT_TO_ROBOT = 0,
+    ROBOT_TO_ROBOT = 1
+};
+
+struct Header{
+    char magic[4];
+    std::uint32_t format_version;
+    std::uint32_t byte_order;
+    std::int32_t vfi_file_version;
+    std::uint32_t zero_indexed;
+    std::uint32_t string_count;
+    std::uint64_t string_slices_offset;
+    std::uint64_t string_bytes_offset;
+    std::uint64_t string_bytes_size;
+    std::uint64_t entity_ids_offset;
+    std::uint64_t entity_id_count;
+    std::uint64_t records_offset;
+    std::uint64_t record_count;
+    std::uint64_t file_size;
+};
+
+struct StringSlice{
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+/**
+ * @brief The Record struct stores one constraint. The "one" fields store the environment entity
+ *        of an ENVIRONMENT_TO_ROBOT constraint and the "two" fields store its robot entity.
+ *        robot_index and joint_index are stored in robot_index_one and joint_index_one.
+ *        The reserved words fill the struct up to its 8-byte alignment, so that no padding is
+ *        written to disk, and are always zero.
+ */
+struct Record{
+    double safe_distance;
+    double buffer;
+    double vfi_gain;
+    RECORD_TYPE type;
+    std::uint32_t vfi_type;
+    std::uint32_t direction;
+    std::uint32_t tag;
+    std::uint32_t primitive_type_one;
+    std::uint32_t primitive_type_two;
+    std::uint32_t entities_one_offset;
+    std::uint32_t entities_one_count;
+    std::uint32_t entities_two_offset;
+    std::uint32_t entities_two_count;
+    std::int32_t robot_index_one;
+    std::int32_t robot_index_two;
+    std::int32_t joint_index_one;
+    std::int32_t joint_index_two;
+    std::uint32_t reserved[2];
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 88, "Unexpected Header layout");
+static_assert(std::is_trivially_copyable_v<StringSlice> && sizeof(StringSlice) == 8, "Unexpected StringSlice layout");
+static_assert(std::is_trivially_copyable_v<Record> && sizeof(Record) == 88, "Unexpected Record layout");
+static_assert(offsetof(Record, reserved) + sizeof(Record::reserved) == sizeof(Record), "Record has tail padding");
+
+/**
+ * @brief align rounds an offset up to the next multiple of 8 bytes.
+ */
+constexpr std::uint64_t align(const std::uint64_t& offset)
+{
+    return (offset + 7) & ~std::uint64_t(7);
+}
+
+/**
+ * @brief validate checks that a memory block contains a complete binary constraint file. It checks
+ *        the header, the bounds of every section and every string and entity reference of the records.
+ *        Throws a std::runtime_error if the data is invalid.
+ * @param data The beginning of the file contents. It must be aligned to 8 bytes.
+ * @param size The size of the file contents.
+ * @return The header of the file.
+ */
+const Header& validate(const char* data, const std::size_t& size);
+
+}
+}
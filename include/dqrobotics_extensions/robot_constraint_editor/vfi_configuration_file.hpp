@@ -22,6 +22,8 @@
 */
 
 #pragma once
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <variant>
@@ -70,6 +72,31 @@ protected:
 public:
     virtual ~VFIConfigurationFile() = default;
 
+    friend bool operator==(const BASE_DATA& lhs, const BASE_DATA& rhs)
+    {
+        return lhs.vfi_type == rhs.vfi_type && lhs.safe_distance == rhs.safe_distance &&
+               lhs.buffer == rhs.buffer && lhs.vfi_gain == rhs.vfi_gain &&
+               lhs.direction == rhs.direction && lhs.tag == rhs.tag;
+    }
+    friend bool operator==(const ENVIRONMENT_TO_ROBOT_DATA& lhs, const ENVIRONMENT_TO_ROBOT_DATA& rhs)
+    {
+        return static_cast<const BASE_DATA&>(lhs) == static_cast<const BASE_DATA&>(rhs) &&
+               lhs.cs_entity_environment == rhs.cs_entity_environment &&
+               lhs.cs_entity_robot == rhs.cs_entity_robot &&
+               lhs.entity_environment_primitive_type == rhs.entity_environment_primitive_type &&
+               lhs.entity_robot_primitive_type == rhs.entity_robot_primitive_type &&
+               lhs.robot_index == rhs.robot_index && lhs.joint_index == rhs.joint_index;
+    }
+    friend bool operator==(const ROBOT_TO_ROBOT_DATA& lhs, const ROBOT_TO_ROBOT_DATA& rhs)
+    {
+        return static_cast<const BASE_DATA&>(lhs) == static_cast<const BASE_DATA&>(rhs) &&
+               lhs.cs_entity_one == rhs.cs_entity_one && lhs.cs_entity_two == rhs.cs_entity_two &&
+               lhs.entity_one_primitive_type == rhs.entity_one_primitive_type &&
+               lhs.entity_two_primitive_type == rhs.entity_two_primitive_type &&
+               lhs.robot_index_one == rhs.robot_index_one && lhs.robot_index_two == rhs.robot_index_two &&
+               lhs.joint_index_one == rhs.joint_index_one && lhs.joint_index_two == rhs.joint_index_two;
+    }
+
     /**
      * @brief load_data loads a configuration file.
      * @param config_file The name of the file including its path and format.
@@ -82,6 +109,13 @@ public:
      */
     virtual std::vector<Data>  get_data() const = 0;
 
+    /**
+     * @brief take_data moves the vector that contains the VFI configurations out of the object,
+     *        which is left without data. The default implementation returns a copy (see get_data()).
+     * @return The desired data vector.
+     */
+    virtual std::vector<Data> take_data() {return get_data();}
+
     /**
      * @brief get_vfi_file_version gets the configuration file version.
      * @return The desired file version.
@@ -95,6 +129,19 @@ public:
      */
     virtual bool is_zero_indexed() const = 0;
 
+    /**
+     * @brief new_instance creates an object of the same class, with the same settings and no data.
+     *        It is used to load several files concurrently, since an object must not be used by
+     *        more than one thread at a time. RobotConstraintEditor needs it to load several files
+     *        (load_data() with a vector of files) and to reload a file (reload_data() and start_watching()).
+     *        The default implementation throws a std::runtime_error, for the backends that do not support it.
+     * @return The new object.
+     */
+    virtual std::shared_ptr<VFIConfigurationFile> new_instance() const
+    {
+        throw std::runtime_error("VFIConfigurationFile::new_instance: Not supported by this backend!");
+    }
+
     /**
      * @brief save_data saves a configuration file containing the VFI constraints.
      * @param data the vector that contains the VFI configurations
@@ -0,0 +1,65 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <memory>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/file_writer.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The VFIConfigurationFileBinary class reads and writes the constraints in the compact binary
+ *        layout described in vfi_binary_format.hpp.
+ */
+class VFIConfigurationFileBinary: public VFIConfigurationFile
+{
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+public:
+    ~VFIConfigurationFileBinary() = default;
+    explicit VFIConfigurationFileBinary();
+
+    void set_save_mode(const FileWriter::SAVE_MODE& save_mode);
+    FileWriter::SAVE_MODE get_save_mode() const;
+    void set_sync_policy(const FileWriter::SYNC_POLICY& sync_policy);
+    FileWriter::SYNC_POLICY get_sync_policy() const;
+    void sync_pending_saves();
+
+    // Override from VFIConfigurationFile
+    std::shared_ptr<VFIConfigurationFile> new_instance() const override;
+    void load_data(const std::string& config_file) override;
+    std::vector<VFIConfigurationFile::Data> get_data() const override;
+    std::vector<VFIConfigurationFile::Data> take_data() override;
+    const std::vector<VFIConfigurationFile::Data>& view_data() const;
+    int get_vfi_file_version() const override;
+    bool is_zero_indexed() const override;
+    void save_data(const std::vector<Data>& data,
+                   const int& vfi_file_version,
+                   const bool& zero_indexed,
+                   const std::string& config_file) override;
+
+};
+}
@@ -0,0 +1,258 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_binary_format.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The VFIConfigurationFileBinaryView class maps a file written by VFIConfigurationFileBinary
+ *        into memory and gives read-only access to its constraints without copying them.
+ *        Strings are returned as std::string_view and entity lists as ranges over the mapping,
+ *        so reading a constraint does not allocate. The mapping is shared, so several processes
+ *        reading the same file share one page-cache copy of it.
+ *        The views returned by this class are valid while the VFIConfigurationFileBinaryView,
+ *        or a copy of it, exists.
+ */
+class VFIConfigurationFileBinaryView
+{
+public:
+    /**
+     * @brief The Sections struct points to the sections of the mapped file.
+     */
+    struct Sections{
+        const VFIBinaryFormat::StringSlice* string_slices = nullptr;
+        const char* string_bytes = nullptr;
+        const std::uint32_t* entity_ids = nullptr;
+        const VFIBinaryFormat::Record* records = nullptr;
+        std::size_t record_count = 0;
+
+        std::string_view string(const std::uint32_t& id) const
+        {
+            return std::string_view(string_bytes + string_slices[id].offset, string_slices[id].size);
+        }
+    };
+
+    /**
+     * @brief The EntityList class is a range of entity names stored in the mapped file.
+     */
+    class EntityList
+    {
+    private:
+        const Sections* sections_;
+        const std::uint32_t* ids_;
+        std::size_t size_;
+    public:
+        class const_iterator
+        {
+        private:
+            const Sections* sections_;
+            const std::uint32_t* id_;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::string_view;
+
+            const_iterator(const Sections* sections, const std::uint32_t* id) : sections_(sections), id_(id) {}
+            std::string_view operator*() const {return sections_->string(*id_);}
+            const_iterator& operator++() {++id_; return *this;}
+            const_iterator operator++(int) {const_iterator it = *this; ++id_; return it;}
+            bool operator==(const const_iterator& other) const {return id_ == other.id_;}
+            bool operator!=(const const_iterator& other) const {return id_ != other.id_;}
+        };
+
+        EntityList(const Sections* sections, const std::uint32_t* ids, const std::size_t& size)
+            : sections_(sections), ids_(ids), size_(size) {}
+        std::size_t size() const {return size_;}
+        bool empty() const {return size_ == 0;}
+        std::string_view operator[](const std::size_t& i) const {return sections_->string(ids_[i]);}
+        const_iterator begin() const {return const_iterator(sections_, ids_);}
+        const_iterator end() const {return const_iterator(sections_, ids_ + size_);}
+    };
+
+    /**
+     * @brief The Constraint class is a read-only view of one constraint of the mapped file.
+     *        The accessors of ENVIRONMENT_TO_ROBOT and ROBOT_TO_ROBOT fields throw a std::runtime_error
+     *        when called on a constraint of the other type.
+     */
+    class Constraint
+    {
+    private:
+        const Sections* sections_;
+        const VFIBinaryFormat::Record* record_;
+
+        void _check_type(const VFIBinaryFormat::RECORD_TYPE& type) const
+        {
+            if (record_->type != type)
+                throw std::runtime_error("Constraint '" + std::string(tag()) + "' does not have this field!");
+        }
+        EntityList _list(const std::uint32_t& offset, const std::uint32_t& count) const
+        {
+            return EntityList(sections_, sections_->entity_ids + offset, count);
+        }
+    public:
+        Constraint(const Sections* sections, const VFIBinaryFormat::Record* record)
+            : sections_(sections), record_(record) {}
+
+        bool is_environment_to_robot() const {return record_->type == VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT;}
+        bool is_robot_to_robot() const {return record_->type == VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT;}
+
+        // BASE_DATA fields
+        std::string_view vfi_type() const {return sections_->string(record_->vfi_type);}
+        double safe_distance() const {return record_->safe_distance;}
+        double buffer() const {return record_->buffer;}
+        double vfi_gain() const {return record_->vfi_gain;}
+        std::string_view direction() const {return sections_->string(record_->direction);}
+        std::string_view tag() const {return sections_->string(record_->tag);}
+
+        // ENVIRONMENT_TO_ROBOT_DATA fields
+        EntityList cs_entity_environment() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return _list(record_->entities_one_offset, record_->entities_one_count);
+        }
+        EntityList cs_entity_robot() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return _list(record_->entities_two_offset, record_->entities_two_count);
+        }
+        std::string_view entity_environment_primitive_type() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return sections_->string(record_->primitive_type_one);
+        }
+        std::string_view entity_robot_primitive_type() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return sections_->string(record_->primitive_type_two);
+        }
+        int robot_index() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return record_->robot_index_one;
+        }
+        int joint_index() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ENVIRONMENT_TO_ROBOT);
+            return record_->joint_index_one;
+        }
+
+        // ROBOT_TO_ROBOT_DATA fields
+        EntityList cs_entity_one() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return _list(record_->entities_one_offset, record_->entities_one_count);
+        }
+        EntityList cs_entity_two() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return _list(record_->entities_two_offset, record_->entities_two_count);
+        }
+        std::string_view entity_one_primitive_type() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return sections_->string(record_->primitive_type_one);
+        }
+        std::string_view entity_two_primitive_type() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return sections_->string(record_->primitive_type_two);
+        }
+        int robot_index_one() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return record_->robot_index_one;
+        }
+        int robot_index_two() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return record_->robot_index_two;
+        }
+        int joint_index_one() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return record_->joint_index_one;
+        }
+        int joint_index_two() const
+        {
+            _check_type(VFIBinaryFormat::RECORD_TYPE::ROBOT_TO_ROBOT);
+            return record_->joint_index_two;
+        }
+
+        VFIConfigurationFile::Data to_data() const;
+    };
+
+    class const_iterator
+    {
+    private:
+        const Sections* sections_;
+        const VFIBinaryFormat::Record* record_;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Constraint;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Constraint;
+
+        const_iterator(const Sections* sections, const VFIBinaryFormat::Record* record) : sections_(sections), record_(record) {}
+        Constraint operator*() const {return Constraint(sections_, record_);}
+        const_iterator& operator++() {++record_; return *this;}
+        const_iterator operator++(int) {const_iterator it = *this; ++record_; return it;}
+        bool operator==(const const_iterator& other) const {return record_ == other.record_;}
+        bool operator!=(const const_iterator& other) const {return record_ != other.record_;}
+    };
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> impl_;
+    const Sections* sections_;
+
+public:
+    explicit VFIConfigurationFileBinaryView(const std::string& config_file);
+
+    int get_vfi_file_version() const;
+    bool is_zero_indexed() const;
+
+    std::size_t size() const {return sections_->record_count;}
+    bool empty() const {return sections_->record_count == 0;}
+    Constraint operator[](const std::size_t& i) const {return Constraint(sections_, sections_->records + i);}
+    Constraint at(const std::size_t& i) const
+    {
+        if (i >= size())
+            throw std::out_of_range("VFIConfigurationFileBinaryView::at: index out of range!");
+        return (*this)[i];
+    }
+    const_iterator begin() const {return const_iterator(sections_, sections_->records);}
+    const_iterator end() const {return const_iterator(sections_, sections_->records + sections_->record_count);}
+};
+}
@@ -23,23 +23,65 @@
 
 #pragma once
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/file_writer.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/interned_constraint_set.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/parse_cache.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_pmr_data.hpp>
 
 namespace DQ_robotics_extensions
 {
 class VFIConfigurationFileYaml: public VFIConfigurationFile
 {
+public:
+    /**
+     * @brief The LOAD_MODE enum defines how load_data() reads the YAML file.
+     *        DOM builds the full YAML::Node tree before extracting the data.
+     *        STREAMING converts each vfi_array item while the file is parsed,
+     *        without keeping the YAML::Node tree in memory.
+     *        PARALLEL_DOM builds the full YAML::Node tree, and then converts the vfi_array
+     *        items in chunks on several threads (see set_number_of_threads()).
+     */
+    enum class LOAD_MODE{
+        DOM,
+        STREAMING,
+        PARALLEL_DOM
+    };
+
 private:
     class Impl;
     std::shared_ptr<Impl> impl_;
 public:
     ~VFIConfigurationFileYaml() = default;
-    explicit VFIConfigurationFileYaml();
+    explicit VFIConfigurationFileYaml(const LOAD_MODE& load_mode = LOAD_MODE::DOM);
+
+    void set_load_mode(const LOAD_MODE& load_mode);
+    LOAD_MODE get_load_mode() const;
+    void set_number_of_threads(const std::size_t& number_of_threads);
+    std::size_t get_number_of_threads() const;
+    void set_save_mode(const FileWriter::SAVE_MODE& save_mode);
+    FileWriter::SAVE_MODE get_save_mode() const;
+    void set_sync_policy(const FileWriter::SYNC_POLICY& sync_policy);
+    FileWriter::SYNC_POLICY get_sync_policy() const;
+    void sync_pending_saves();
+    void set_parse_cache(const std::shared_ptr<ParseCache>& parse_cache);
+    std::shared_ptr<ParseCache> get_parse_cache() const;
+
+    void load_interned_data(const std::string& config_file, InternedConstraintSet& interned_data);
+    void save_interned_data(const InternedConstraintSet& interned_data,
+                            const int& vfi_file_version,
+                            const bool& zero_indexed,
+                            const std::string& config_file);
+    void load_pmr_data(const std::string& config_file, std::pmr::vector<VFIPmrData::Data>& data);
 
     // Override from VFIConfigurationFile
+    std::shared_ptr<VFIConfigurationFile> new_instance() const override;
     void load_data(const std::string& config_file) override;
     std::vector<VFIConfigurationFile::Data> get_data() const override;
+    std::vector<VFIConfigurationFile::Data> take_data() override;
+    const std::vector<VFIConfigurationFile::Data>& view_data() const;
     int get_vfi_file_version() const override;
     bool is_zero_indexed() const override;
     void save_data(const std::vector<Data>& data,
@@ -0,0 +1,167 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * Compile-time description of the fields of the VFI data structs.
+ *
+ * Each Table lists the fields of a struct in the order used by the configuration files, with
+ * their key and a pointer to the member. The fields inherited from BASE_DATA point to the
+ * BASE_DATA members, which can be applied to the derived structs as well.
+ *
+ * Example:
+ *     VFIDataFields::for_each<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>([&](const auto& field, auto) {
+ *         std::cout << field.name << ": " << data.*field.member << std::endl;
+ *     });
+ */
+namespace VFIDataFields
+{
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+template<typename Owner, typename FieldType>
+struct Field{
+    using type = FieldType;
+    const char* name;
+    FieldType Owner::* member;
+};
+
+template<typename Owner, typename FieldType>
+constexpr Field<Owner, FieldType> make_field(const char* name, FieldType Owner::* member)
+{
+    return {name, member};
+}
+
+template<typename DataType>
+struct Table;
+
+template<>
+struct Table<VFIConfigurationFile::BASE_DATA>{
+    using BASE = VFIConfigurationFile::BASE_DATA;
+    static constexpr const char* name = "BASE";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+
+template<>
+struct Table<VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>{
+    using BASE = VFIConfigurationFile::BASE_DATA;
+    using ENV = VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA;
+    static constexpr const char* name = "ENVIRONMENT_TO_ROBOT";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("cs_entity_environment", &ENV::cs_entity_environment),
+        make_field("cs_entity_robot", &ENV::cs_entity_robot),
+        make_field("entity_environment_primitive_type", &ENV::entity_environment_primitive_type),
+        make_field("entity_robot_primitive_type", &ENV::entity_robot_primitive_type),
+        make_field("robot_index", &ENV::robot_index),
+        make_field("joint_index", &ENV::joint_index),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+
+template<>
+struct Table<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>{
+    using BASE = VFIConfigurationFile::BASE_DATA;
+    using R2R = VFIConfigurationFile::ROBOT_TO_ROBOT_DATA;
+    static constexpr const char* name = "ROBOT_TO_ROBOT";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("cs_entity_one", &R2R::cs_entity_one),
+        make_field("cs_entity_two", &R2R::cs_entity_two),
+        make_field("entity_one_primitive_type", &R2R::entity_one_primitive_type),
+        make_field("entity_two_primitive_type", &R2R::entity_two_primitive_type),
+        make_field("robot_index_one", &R2R::robot_index_one),
+        make_field("robot_index_two", &R2R::robot_index_two),
+        make_field("joint_index_one", &R2R::joint_index_one),
+        make_field("joint_index_two", &R2R::joint_index_two),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+
+/**
+ * @brief size returns the number of fields of a struct.
+ */
+template<typename DataType>
+constexpr std::size_t size()
+{
+    return std::tuple_size_v<std::remove_const_t<decltype(Table<DataType>::fields)>>;
+}
+
+/**
+ * @brief field_type is the type of the I-th field of a struct.
+ */
+template<typename DataType, std::size_t I>
+using field_type = typename std::tuple_element_t<I, std::remove_const_t<decltype(Table<DataType>::fields)>>::type;
+
+template<typename DataType, typename Function, std::size_t... I>
+constexpr void _for_each(Function& function, std::index_sequence<I...>)
+{
+    (function(std::get<I>(Table<DataType>::fields), std::integral_constant<std::size_t, I>()), ...);
+}
+
+/**
+ * @brief for_each calls function(field, index) for each field of a struct, in order. The index is
+ *        a std::integral_constant, so it can be used in constant expressions.
+ */
+template<typename DataType, typename Function>
+constexpr void for_each(Function&& function)
+{
+    _for_each<DataType>(function, std::make_index_sequence<size<DataType>()>());
+}
+
+/**
+ * @brief find returns the index of the field with the given key, or npos if the struct has no such field.
+ */
+template<typename DataType>
+constexpr std::size_t find(const std::string_view& key)
+{
+    std::size_t index = npos;
+    for_each<DataType>([&](const auto& field, auto i) {
+        if (index == npos && key == field.name)
+            index = decltype(i)::value;
+    });
+    return index;
+}
+
+}
+}
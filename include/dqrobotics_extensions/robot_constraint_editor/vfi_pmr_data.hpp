@@ -0,0 +1,293 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_data_fields.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * Allocator-aware versions of the VFI data structs.
+ *
+ * The structs have the same fields as the ones in VFIConfigurationFile, but their strings and
+ * vectors use std::pmr, so all their memory can come from a single std::pmr::memory_resource.
+ * They follow the uses-allocator convention, so a std::pmr::vector of ENVIRONMENT_TO_ROBOT_DATA
+ * passes its allocator to the elements. Since std::variant is not allocator-aware, Data values must
+ * be built with from_data() or copy_data() to place them in a resource.
+ *
+ * Example (the whole session lives in one arena and is released at once):
+ *     std::pmr::monotonic_buffer_resource arena;
+ *     std::pmr::vector<VFIPmrData::Data> data(&arena);
+ *     yaml.load_pmr_data("constraints.yaml", data);
+ */
+namespace VFIPmrData
+{
+using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+struct BASE_DATA{
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    std::pmr::string vfi_type;
+    double safe_distance = 0.0;
+    double buffer = 0.0;  //Default value
+    double vfi_gain = 0.0;
+    std::pmr::string direction;
+    std::pmr::string tag;
+
+    BASE_DATA() = default;
+    BASE_DATA(const BASE_DATA&) = default;
+    BASE_DATA(BASE_DATA&&) = default;
+    BASE_DATA& operator=(const BASE_DATA&) = default;
+    BASE_DATA& operator=(BASE_DATA&&) = default;
+
+    explicit BASE_DATA(const allocator_type& allocator)
+        : vfi_type(allocator), direction(allocator), tag(allocator) {}
+    BASE_DATA(const BASE_DATA& other, const allocator_type& allocator)
+        : vfi_type(other.vfi_type, allocator), safe_distance(other.safe_distance), buffer(other.buffer),
+          vfi_gain(other.vfi_gain), direction(other.direction, allocator), tag(other.tag, allocator) {}
+    BASE_DATA(BASE_DATA&& other, const allocator_type& allocator)
+        : vfi_type(std::move(other.vfi_type), allocator), safe_distance(other.safe_distance), buffer(other.buffer),
+          vfi_gain(other.vfi_gain), direction(std::move(other.direction), allocator), tag(std::move(other.tag), allocator) {}
+
+    allocator_type get_allocator() const
+    {
+        return tag.get_allocator();
+    }
+};
+
+struct ENVIRONMENT_TO_ROBOT_DATA : BASE_DATA{
+    std::pmr::vector<std::pmr::string> cs_entity_environment;
+    std::pmr::vector<std::pmr::string> cs_entity_robot;
+    std::pmr::string entity_environment_primitive_type;
+    std::pmr::string entity_robot_primitive_type;
+    int robot_index = 0;
+    int joint_index = 0;
+
+    ENVIRONMENT_TO_ROBOT_DATA() = default;
+    ENVIRONMENT_TO_ROBOT_DATA(const ENVIRONMENT_TO_ROBOT_DATA&) = default;
+    ENVIRONMENT_TO_ROBOT_DATA(ENVIRONMENT_TO_ROBOT_DATA&&) = default;
+    ENVIRONMENT_TO_ROBOT_DATA& operator=(const ENVIRONMENT_TO_ROBOT_DATA&) = default;
+    ENVIRONMENT_TO_ROBOT_DATA& operator=(ENVIRONMENT_TO_ROBOT_DATA&&) = default;
+
+    explicit ENVIRONMENT_TO_ROBOT_DATA(const allocator_type& allocator)
+        : BASE_DATA(allocator), cs_entity_environment(allocator), cs_entity_robot(allocator),
+          entity_environment_primitive_type(allocator), entity_robot_primitive_type(allocator) {}
+    ENVIRONMENT_TO_ROBOT_DATA(const ENVIRONMENT_TO_ROBOT_DATA& other, const allocator_type& allocator)
+        : BASE_DATA(other, allocator),
+          cs_entity_environment(other.cs_entity_environment, allocator),
+          cs_entity_robot(other.cs_entity_robot, allocator),
+          entity_environment_primitive_type(other.entity_environment_primitive_type, allocator),
+          entity_robot_primitive_type(other.entity_robot_primitive_type, allocator),
+          robot_index(other.robot_index), joint_index(other.joint_index) {}
+    ENVIRONMENT_TO_ROBOT_DATA(ENVIRONMENT_TO_ROBOT_DATA&& other, const allocator_type& allocator)
+        : BASE_DATA(std::move(other), allocator),
+          cs_entity_environment(std::move(other.cs_entity_environment), allocator),
+          cs_entity_robot(std::move(other.cs_entity_robot), allocator),
+          entity_environment_primitive_type(std::move(other.entity_environment_primitive_type), allocator),
+          entity_robot_primitive_type(std::move(other.entity_robot_primitive_type), allocator),
+          robot_index(other.robot_index), joint_index(other.joint_index) {}
+};
+
+struct ROBOT_TO_ROBOT_DATA : BASE_DATA{
+    std::pmr::vector<std::pmr::string> cs_entity_one;
+    std::pmr::vector<std::pmr::string> cs_entity_two;
+    std::pmr::string entity_one_primitive_type;
+    std::pmr::string entity_two_primitive_type;
+    int robot_index_one = 0;
+    int robot_index_two = 0;
+    int joint_index_one = 0;
+    int joint_index_two = 0;
+
+    ROBOT_TO_ROBOT_DATA() = default;
+    ROBOT_TO_ROBOT_DATA(const ROBOT_TO_ROBOT_DATA&) = default;
+    ROBOT_TO_ROBOT_DATA(ROBOT_TO_ROBOT_DATA&&) = default;
+    ROBOT_TO_ROBOT_DATA& operator=(const ROBOT_TO_ROBOT_DATA&) = default;
+    ROBOT_TO_ROBOT_DATA& operator=(ROBOT_TO_ROBOT_DATA&&) = default;
+
+    explicit ROBOT_TO_ROBOT_DATA(const allocator_type& allocator)
+        : BASE_DATA(allocator), cs_entity_one(allocator), cs_entity_two(allocator),
+          entity_one_primitive_type(allocator), entity_two_primitive_type(allocator) {}
+    ROBOT_TO_ROBOT_DATA(const ROBOT_TO_ROBOT_DATA& other, const allocator_type& allocator)
+        : BASE_DATA(other, allocator),
+          cs_entity_one(other.cs_entity_one, allocator), cs_entity_two(other.cs_entity_two, allocator),
+          entity_one_primitive_type(other.entity_one_primitive_type, allocator),
+          entity_two_primitive_type(other.entity_two_primitive_type, allocator),
+          robot_index_one(other.robot_index_one), robot_index_two(other.robot_index_two),
+          joint_index_one(other.joint_index_one), joint_index_two(other.joint_index_two) {}
+    ROBOT_TO_ROBOT_DATA(ROBOT_TO_ROBOT_DATA&& other, const allocator_type& allocator)
+        : BASE_DATA(std::move(other), allocator),
+          cs_entity_one(std::move(other.cs_entity_one), allocator),
+          cs_entity_two(std::move(other.cs_entity_two), allocator),
+          entity_one_primitive_type(std::move(other.entity_one_primitive_type), allocator),
+          entity_two_primitive_type(std::move(other.entity_two_primitive_type), allocator),
+          robot_index_one(other.robot_index_one), robot_index_two(other.robot_index_two),
+          joint_index_one(other.joint_index_one), joint_index_two(other.joint_index_two) {}
+};
+
+using Data = std::variant<ENVIRONMENT_TO_ROBOT_DATA, ROBOT_TO_ROBOT_DATA>;
+
+}
+
+namespace VFIDataFields
+{
+template<>
+struct Table<VFIPmrData::BASE_DATA>{
+    using BASE = VFIPmrData::BASE_DATA;
+    static constexpr const char* name = "BASE";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+
+template<>
+struct Table<VFIPmrData::ENVIRONMENT_TO_ROBOT_DATA>{
+    using BASE = VFIPmrData::BASE_DATA;
+    using ENV = VFIPmrData::ENVIRONMENT_TO_ROBOT_DATA;
+    static constexpr const char* name = "ENVIRONMENT_TO_ROBOT";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("cs_entity_environment", &ENV::cs_entity_environment),
+        make_field("cs_entity_robot", &ENV::cs_entity_robot),
+        make_field("entity_environment_primitive_type", &ENV::entity_environment_primitive_type),
+        make_field("entity_robot_primitive_type", &ENV::entity_robot_primitive_type),
+        make_field("robot_index", &ENV::robot_index),
+        make_field("joint_index", &ENV::joint_index),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+
+template<>
+struct Table<VFIPmrData::ROBOT_TO_ROBOT_DATA>{
+    using BASE = VFIPmrData::BASE_DATA;
+    using R2R = VFIPmrData::ROBOT_TO_ROBOT_DATA;
+    static constexpr const char* name = "ROBOT_TO_ROBOT";
+    static constexpr auto fields = std::make_tuple(
+        make_field("vfi_type", &BASE::vfi_type),
+        make_field("cs_entity_one", &R2R::cs_entity_one),
+        make_field("cs_entity_two", &R2R::cs_entity_two),
+        make_field("entity_one_primitive_type", &R2R::entity_one_primitive_type),
+        make_field("entity_two_primitive_type", &R2R::entity_two_primitive_type),
+        make_field("robot_index_one", &R2R::robot_index_one),
+        make_field("robot_index_two", &R2R::robot_index_two),
+        make_field("joint_index_one", &R2R::joint_index_one),
+        make_field("joint_index_two", &R2R::joint_index_two),
+        make_field("safe_distance", &BASE::safe_distance),
+        make_field("buffer", &BASE::buffer),
+        make_field("vfi_gain", &BASE::vfi_gain),
+        make_field("direction", &BASE::direction),
+        make_field("tag", &BASE::tag));
+};
+}
+
+namespace VFIPmrData
+{
+template<typename Target, typename Source>
+void _assign_value(Target& target, const Source& source)
+{
+    if constexpr (std::is_arithmetic_v<Target>) {
+        target = source;
+    } else if constexpr (std::is_convertible_v<const Source&, std::string_view>) {
+        target.assign(source.data(), source.size());
+    } else {
+        // Lists of strings. The elements are built with the allocator of the target.
+        target.clear();
+        target.reserve(source.size());
+        for (const auto& item : source)
+            target.emplace_back(item.data(), item.size());
+    }
+}
+
+/**
+ * @brief _assign_fields copies the fields of a struct to the equivalent struct of the other family
+ *        (std or std::pmr), field by field, using the tables in VFIDataFields.
+ */
+template<typename Target, typename Source>
+void _assign_fields(Target& target, const Source& source)
+{
+    static_assert(VFIDataFields::size<Target>() == VFIDataFields::size<Source>());
+    VFIDataFields::for_each<Target>([&](const auto& field, auto index) {
+        const auto& source_field = std::get<decltype(index)::value>(VFIDataFields::Table<Source>::fields);
+        _assign_value(target.*field.member, source.*source_field.member);
+    });
+}
+
+/**
+ * @brief from_data copies a VFIConfigurationFile::Data to a Data whose memory comes from an allocator.
+ */
+inline Data from_data(const VFIConfigurationFile::Data& data, const allocator_type& allocator = {})
+{
+    if (std::holds_alternative<VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(data))
+    {
+        ENVIRONMENT_TO_ROBOT_DATA pmr_data(allocator);
+        _assign_fields(pmr_data, std::get<VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(data));
+        return Data(std::in_place_index<0>, std::move(pmr_data));
+    }
+    ROBOT_TO_ROBOT_DATA pmr_data(allocator);
+    _assign_fields(pmr_data, std::get<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>(data));
+    return Data(std::in_place_index<1>, std::move(pmr_data));
+}
+
+/**
+ * @brief copy_data copies a Data to another one whose memory comes from an allocator.
+ */
+inline Data copy_data(const Data& data, const allocator_type& allocator = {})
+{
+    return std::visit([&](const auto& arg) -> Data {
+        using DataType = std::decay_t<decltype(arg)>;
+        return Data(std::in_place_type<DataType>, arg, allocator);
+    }, data);
+}
+
+/**
+ * @brief to_data copies a Data to a VFIConfigurationFile::Data.
+ */
+inline VFIConfigurationFile::Data to_data(const Data& data)
+{
+    if (std::holds_alternative<ENVIRONMENT_TO_ROBOT_DATA>(data))
+    {
+        VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA std_data;
+        _assign_fields(std_data, std::get<ENVIRONMENT_TO_ROBOT_DATA>(data));
+        return std_data;
+    }
+    VFIConfigurationFile::ROBOT_TO_ROBOT_DATA std_data;
+    _assign_fields(std_data, std::get<ROBOT_TO_ROBOT_DATA>(data));
+    return std_data;
+}
+
+}
+}
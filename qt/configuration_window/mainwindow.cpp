@@ -39,6 +39,13 @@ MainWindow::MainWindow(QWidget *parent)
 {
     ui->setupUi(this);
     _connect_signal_to_slots();
+    // The callback runs on the thread that modified the constraints, and while the editor is locked,
+    // so the actions are updated later on the GUI thread
+    change_subscription_ = robot_constraint_editor_.subscribe(
+        [this](const std::vector<RobotConstraintEditor::ChangeEvent>&) {
+            QMetaObject::invokeMethod(this, [this]() {_update_undo_redo_actions();}, Qt::QueuedConnection);
+        });
+    _update_undo_redo_actions();
 }
 
 /**
@@ -46,6 +53,7 @@ MainWindow::MainWindow(QWidget *parent)
  */
 MainWindow::~MainWindow()
 {
+    robot_constraint_editor_.unsubscribe(change_subscription_);
     delete ui;
 }
 
@@ -57,6 +65,8 @@ MainWindow::~MainWindow()
 void MainWindow::_connect_signal_to_slots()
 {
     QObject::connect(ui->open_file_action, &QAction::triggered, this, &MainWindow::open_file_action_triggered);
+    QObject::connect(ui->undo_action, &QAction::triggered, this, &MainWindow::undo_action_triggered);
+    QObject::connect(ui->redo_action, &QAction::triggered, this, &MainWindow::redo_action_triggered);
 
 }
 
@@ -100,4 +110,33 @@ void MainWindow::open_file_action_triggered()
     }
 }
 
+/**
+ * @brief MainWindow::undo_action_triggered is a QT slot which reverts the last change of the constraints
+ *                                          (either by pressing the hotbar button or by using the shortcut Ctrl+z).
+ */
+void MainWindow::undo_action_triggered()
+{
+    robot_constraint_editor_.undo();
+    _update_undo_redo_actions();
+}
 
+/**
+ * @brief MainWindow::redo_action_triggered is a QT slot which applies again the last reverted change
+ *                                          (either by pressing the hotbar button or by using the shortcut Ctrl+Shift+z).
+ */
+void MainWindow::redo_action_triggered()
+{
+    robot_constraint_editor_.redo();
+    _update_undo_redo_actions();
+}
+
+/**
+ * @brief MainWindow::_update_undo_redo_actions enables the undo and redo actions only if there is something
+ *                                              to undo or redo. It is called after every change of the constraints
+ *                                              (including loads, undos and redos) by the subscription of the ctor.
+ */
+void MainWindow::_update_undo_redo_actions()
+{
+    ui->undo_action->setEnabled(robot_constraint_editor_.can_undo());
+    ui->redo_action->setEnabled(robot_constraint_editor_.can_redo());
+}
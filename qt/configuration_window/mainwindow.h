@@ -52,12 +52,16 @@ public slots:
     void file_open_value_returned_from_dialog(QString file_path);
 private slots:
     void open_file_action_triggered();
+    void undo_action_triggered();
+    void redo_action_triggered();
 
 private:
     Ui::MainWindow *ui;
     void _connect_signal_to_slots();
+    void _update_undo_redo_actions();
     QString constraint_file_filepath_;
     std::shared_ptr<DQ_robotics_extensions::VFIConfigurationFileYaml> vfi_yaml_;
     DQ_robotics_extensions::RobotConstraintEditor robot_constraint_editor_;
+    std::size_t change_subscription_ = 0;
 };
 
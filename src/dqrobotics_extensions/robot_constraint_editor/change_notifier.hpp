@@ -0,0 +1,359 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_data_fields.hpp>
+#include "constraint_store.hpp"
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief The ChangeNotifier class collects the change events of the RobotConstraintEditor and delivers
+ *        them to the subscribers, one batch per modification of the editor (see Scope). The batches of
+ *        the coalescing subscribers are merged, and can be held for longer with pause(). The events are
+ *        only collected while there are subscribers.
+ *        This class is internal to the library.
+ */
+class ChangeNotifier
+{
+public:
+    using ChangeEvent = RobotConstraintEditor::ChangeEvent;
+    using ChangeCallback = RobotConstraintEditor::ChangeCallback;
+
+    /**
+     * @brief The Scope class delivers the events collected during its lifetime as a single batch.
+     *        Scopes can be nested; only the outermost one delivers the batch.
+     */
+    class Scope{
+        ChangeNotifier& notifier_;
+    public:
+        explicit Scope(ChangeNotifier& notifier)
+            : notifier_(notifier)
+        {
+            ++notifier_.nesting_;
+        }
+        ~Scope()
+        {
+            if (--notifier_.nesting_ == 0)
+                notifier_._deliver();
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    struct Subscriber{
+        std::size_t id;
+        ChangeCallback callback;
+        bool coalesce;
+    };
+
+    // A run of simultaneous renames: the position of its first event and the number of events
+    using Run = std::pair<std::size_t, std::size_t>;
+
+    std::vector<Subscriber> subscribers_;
+    std::size_t next_id_ = 1;
+    std::size_t nesting_ = 0;
+    bool is_paused_ = false;
+    std::vector<ChangeEvent> pending_;  // The events of the current modification
+    std::vector<Run> pending_runs_;
+    std::vector<ChangeEvent> held_;     // The events not delivered yet to the coalescing subscribers
+    std::vector<Run> held_runs_;
+
+    /**
+     * @brief _call calls the subscribers of a kind. The batch is delivered by a destructor (which is
+     *        noexcept), so every exception is caught and printed to std::cerr.
+     */
+    void _call(const std::vector<ChangeEvent>& events, const bool& coalesce)
+    {
+        // A copy, since a callback may unsubscribe
+        const auto subscribers = subscribers_;
+        for (const auto& subscriber : subscribers)
+        {
+            if (subscriber.coalesce != coalesce)
+                continue;
+            try {
+                subscriber.callback(events);
+            } catch (const std::exception& e) {
+                std::cerr<<"RobotConstraintEditor: A change callback failed: "<<e.what()<<std::endl;
+            } catch (...) {
+                std::cerr<<"RobotConstraintEditor: A change callback failed with an unknown exception"<<std::endl;
+            }
+        }
+    }
+
+    bool _has_subscribers(const bool& coalesce) const
+    {
+        return std::any_of(subscribers_.begin(), subscribers_.end(), [&](const Subscriber& subscriber) {
+            return subscriber.coalesce == coalesce;
+        });
+    }
+
+    void _deliver()
+    {
+        if (pending_.empty())
+            return;
+        const std::vector<ChangeEvent> events = std::move(pending_);
+        const std::vector<Run> runs = std::move(pending_runs_);
+        pending_.clear();
+        pending_runs_.clear();
+        if (_has_subscribers(true))
+        {
+            for (const auto& run : runs)
+                held_runs_.emplace_back(held_.size() + run.first, run.second);
+            held_.insert(held_.end(), events.begin(), events.end());
+        }
+        _call(events, false);
+        if (!is_paused_)
+            _deliver_held();
+    }
+
+    void _deliver_held()
+    {
+        if (held_.empty())
+            return;
+        const auto coalesced = coalesce(held_, held_runs_);
+        held_.clear();
+        held_runs_.clear();
+        if (!coalesced.empty())
+            _call(coalesced, true);
+    }
+
+    void _push(const ChangeEvent::TYPE& type, const std::string& tag)
+    {
+        pending_.push_back({type, tag, {}, {}, {}});
+    }
+
+public:
+    /**
+     * @brief is_active returns true if the events are being collected. Check it before computing an event.
+     */
+    bool is_active() const
+    {
+        return nesting_ > 0 && !subscribers_.empty();
+    }
+
+    std::size_t subscribe(const ChangeCallback& callback, const bool& coalesce)
+    {
+        subscribers_.push_back({next_id_, callback, coalesce});
+        return next_id_++;
+    }
+
+    bool unsubscribe(const std::size_t& id)
+    {
+        for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it)
+            if (it->id == id)
+            {
+                subscribers_.erase(it);
+                return true;
+            }
+        return false;
+    }
+
+    void pause()
+    {
+        is_paused_ = true;
+    }
+
+    /**
+     * @brief resume delivers the events held since pause() to the coalescing subscribers.
+     */
+    void resume()
+    {
+        is_paused_ = false;
+        if (nesting_ == 0)
+            _deliver_held();
+    }
+
+    void added(const std::string& tag)
+    {
+        if (is_active())
+            _push(ChangeEvent::TYPE::ADDED, tag);
+    }
+
+    void removed(const std::string& tag)
+    {
+        if (is_active())
+            _push(ChangeEvent::TYPE::REMOVED, tag);
+    }
+
+    /**
+     * @brief changed reports the simultaneous modification of several constraints (e.g. a batch edit),
+     *        given as pairs of pointers to the old and new data. The events are, in this order: the
+     *        removals and the renames, the EDITED events of the other modified fields, and the additions.
+     *        A constraint whose type changed is reported as a removal and an addition.
+     */
+    void changed(const std::vector<std::pair<const VFIConfigurationFile::Data*, const VFIConfigurationFile::Data*>>& changes)
+    {
+        if (!is_active())
+            return;
+        auto is_same_type = [](const auto& change) {
+            return change.first->index() == change.second->index();
+        };
+        for (const auto& change : changes)
+            if (!is_same_type(change))
+                removed(ConstraintStore::tag_of(*change.first));
+
+        const std::size_t first_rename = pending_.size();
+        for (const auto& change : changes)
+        {
+            const std::string& old_tag = ConstraintStore::tag_of(*change.first);
+            const std::string& new_tag = ConstraintStore::tag_of(*change.second);
+            if (is_same_type(change) && old_tag != new_tag)
+                pending_.push_back({ChangeEvent::TYPE::EDITED, new_tag, "tag", old_tag, new_tag});
+        }
+        if (pending_.size() - first_rename > 1)
+            pending_runs_.emplace_back(first_rename, pending_.size() - first_rename);
+
+        for (const auto& change : changes)
+        {
+            if (!is_same_type(change))
+                continue;
+            std::visit([&](const auto& new_arg) {
+                using DataType = std::decay_t<decltype(new_arg)>;
+                const auto& old_arg = std::get<DataType>(*change.first);
+                VFIDataFields::for_each<DataType>([&](const auto& field, auto) {
+                    const auto& old_value = old_arg.*field.member;
+                    const auto& new_value = new_arg.*field.member;
+                    if (old_value != new_value && std::string_view(field.name) != "tag")
+                        pending_.push_back({ChangeEvent::TYPE::EDITED, new_arg.tag, field.name, old_value, new_value});
+                });
+            }, *change.second);
+        }
+
+        for (const auto& change : changes)
+            if (!is_same_type(change))
+                added(ConstraintStore::tag_of(*change.second));
+    }
+
+    void changed(const VFIConfigurationFile::Data& old_data, const VFIConfigurationFile::Data& new_data)
+    {
+        changed({{&old_data, &new_data}});
+    }
+
+    /**
+     * @brief coalesce merges a sequence of events: the edits of the same key of a constraint become one
+     *        edit (from the first old value to the last new value), edits that restore the old value are
+     *        dropped, the edits of a constraint added in the sequence are part of its addition, and a
+     *        constraint added and removed in the sequence is not reported. The constraints are followed
+     *        through their renames. The result lists the removals (with the tags before the sequence),
+     *        the renames (which are simultaneous), the other edits and the additions (with the tags after
+     *        the sequence), in this order.
+     * @param events The events.
+     * @param runs The runs of simultaneous renames in the events, sorted by position.
+     */
+    static std::vector<ChangeEvent> coalesce(const std::vector<ChangeEvent>& events, const std::vector<Run>& runs)
+    {
+        struct Entry{
+            bool is_added = false;
+            bool is_removed = false;
+            std::string original_tag;
+            std::string tag;
+            std::vector<ChangeEvent> edits;  // One per key
+        };
+        std::vector<Entry> entries;
+        std::unordered_map<std::string, std::size_t> entry_of_tag;  // The current tags
+
+        auto find_entry = [&](const std::string& tag) -> std::size_t {
+            const auto [it, inserted] = entry_of_tag.try_emplace(tag, entries.size());
+            if (inserted)
+                entries.push_back({false, false, tag, tag, {}});
+            return it->second;
+        };
+        auto add_edit = [&](const std::size_t& index, const ChangeEvent& event) {
+            auto& edits = entries[index].edits;
+            auto edit = std::find_if(edits.begin(), edits.end(), [&](const ChangeEvent& other) {
+                return other.key == event.key;
+            });
+            if (edit == edits.end())
+                edits.push_back(event);
+            else
+                edit->new_value = event.new_value;
+        };
+
+        auto run = runs.begin();
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            const auto& event = events[i];
+            if (event.type == ChangeEvent::TYPE::ADDED)
+            {
+                entry_of_tag[event.tag] = entries.size();
+                entries.push_back({true, false, event.tag, event.tag, {}});
+            }
+            else if (event.type == ChangeEvent::TYPE::REMOVED)
+            {
+                entries[find_entry(event.tag)].is_removed = true;
+                entry_of_tag.erase(event.tag);
+            }
+            else if (event.key == "tag")
+            {
+                // The renames of a run are simultaneous: all the old tags are looked up before any new tag is set
+                const std::size_t size = run != runs.end() && run->first == i ? (run++)->second : 1;
+                std::vector<std::size_t> indexes;
+                for (std::size_t j = i; j < i + size; ++j)
+                    indexes.push_back(find_entry(std::get<std::string>(events[j].old_value)));
+                for (std::size_t j = i; j < i + size; ++j)
+                    entry_of_tag.erase(std::get<std::string>(events[j].old_value));
+                for (std::size_t j = i; j < i + size; ++j)
+                {
+                    const std::size_t index = indexes[j - i];
+                    entry_of_tag[events[j].tag] = index;
+                    entries[index].tag = events[j].tag;
+                    add_edit(index, events[j]);
+                }
+                i += size - 1;
+            }
+            else
+                add_edit(find_entry(event.tag), event);
+        }
+
+        std::vector<ChangeEvent> coalesced;
+        for (const auto& entry : entries)
+            if (entry.is_removed && !entry.is_added)
+                coalesced.push_back({ChangeEvent::TYPE::REMOVED, entry.original_tag, {}, {}, {}});
+        for (const bool& is_rename : {true, false})
+            for (auto& entry : entries)
+                if (!entry.is_added && !entry.is_removed)
+                    for (auto& edit : entry.edits)
+                        if ((edit.key == "tag") == is_rename && edit.old_value != edit.new_value)
+                        {
+                            edit.tag = entry.tag;
+                            coalesced.push_back(std::move(edit));
+                        }
+        for (const auto& entry : entries)
+            if (entry.is_added && !entry.is_removed)
+                coalesced.push_back({ChangeEvent::TYPE::ADDED, entry.tag, {}, {}, {}});
+        return coalesced;
+    }
+};
+
+}
@@ -0,0 +1,149 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief The ConstraintChanges class keeps track of the constraints of the RobotConstraintEditor that
+ *        changed since the last save: a flag per store index for the added and modified constraints,
+ *        and the tags that were removed (or renamed). Like ConstraintIndices, it must be told about
+ *        every change of the store, including the moves done by ConstraintStore::erase(). While the
+ *        tracking is disabled (e.g. when the changes are written to a journal as they happen), it only
+ *        follows the indexes of the store.
+ *        This class is internal to the library.
+ */
+class ConstraintChanges
+{
+    std::vector<std::uint8_t> changed_;  // Indexed like the store
+    std::size_t number_of_changed_ = 0;
+    std::unordered_set<std::string> removed_tags_;
+    bool is_tracking_ = true;
+
+    void _mark(const std::size_t& index)
+    {
+        if (index >= changed_.size())
+            changed_.resize(index + 1, 0);
+        if (!is_tracking_)
+            return;
+        number_of_changed_ += !changed_[index];
+        changed_[index] = 1;
+    }
+
+public:
+    /**
+     * @brief clear forgets the changes, keeping one clean flag per constraint of the store.
+     */
+    void clear(const std::size_t& size)
+    {
+        changed_.assign(size, 0);
+        number_of_changed_ = 0;
+        removed_tags_.clear();
+    }
+
+    void set_tracking(const bool& is_tracking)
+    {
+        is_tracking_ = is_tracking;
+    }
+
+    void reserve(const std::size_t& size)
+    {
+        changed_.reserve(size);
+    }
+
+    void insert(const std::size_t& index)
+    {
+        _mark(index);
+    }
+
+    void update(const std::size_t& index)
+    {
+        _mark(index);
+    }
+
+    /**
+     * @brief rename records that the constraint at a store index lost its previous tag.
+     */
+    void rename(const std::size_t& index, const std::string& old_tag)
+    {
+        if (is_tracking_)
+            removed_tags_.insert(old_tag);
+        _mark(index);
+    }
+
+    /**
+     * @brief erase records the removal of the constraint at a store index. If the store moved its last
+     *        entry to that index, call move() afterwards.
+     */
+    void erase(const std::size_t& index, const std::string& tag)
+    {
+        if (is_tracking_)
+            removed_tags_.insert(tag);
+        number_of_changed_ -= changed_[index];
+        changed_[index] = 0;
+        if (index + 1 == changed_.size())
+            changed_.pop_back();
+    }
+
+    void move(const std::size_t& from, const std::size_t& to)
+    {
+        changed_[to] = changed_[from];
+        changed_.pop_back();
+    }
+
+    bool empty() const
+    {
+        return number_of_changed_ == 0 && removed_tags_.empty();
+    }
+
+    /**
+     * @brief size returns the number of changed constraints plus the number of removed tags.
+     */
+    std::size_t size() const
+    {
+        return number_of_changed_ + removed_tags_.size();
+    }
+
+    bool is_changed(const std::size_t& index) const
+    {
+        return index < changed_.size() && changed_[index];
+    }
+
+    std::size_t number_of_indexes() const
+    {
+        return changed_.size();
+    }
+
+    const std::unordered_set<std::string>& removed_tags() const
+    {
+        return removed_tags_;
+    }
+};
+
+}
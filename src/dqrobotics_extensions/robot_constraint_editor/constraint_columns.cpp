@@ -0,0 +1,449 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_columns.hpp>
+#include <functional>
+#include <stdexcept>
+#include <variant>
+
+namespace DQ_robotics_extensions
+{
+
+class ConstraintColumns::Impl
+{
+public:
+    std::vector<TYPE> types_;
+    std::vector<double> safe_distances_;
+    std::vector<double> buffers_;
+    std::vector<double> vfi_gains_;
+    std::vector<std::int32_t> robot_indexes_one_;
+    std::vector<std::int32_t> robot_indexes_two_;
+    std::vector<std::int32_t> joint_indexes_one_;
+    std::vector<std::int32_t> joint_indexes_two_;
+    std::vector<std::string> tags_;
+
+    Impl()
+    {
+
+    };
+
+    /**
+     * @brief _with_column calls function(value), where value(i) returns the element i of a column.
+     *        The switch is done once per call, so the loops of the kernels have no branches on the column.
+     */
+    template<typename Function>
+    auto _with_column(const COLUMN& column, Function&& function) const
+    {
+        const double* safe_distances = safe_distances_.data();
+        const double* buffers = buffers_.data();
+        const double* vfi_gains = vfi_gains_.data();
+        switch (column)
+        {
+        case COLUMN::SAFE_DISTANCE:
+            return function([safe_distances](const std::size_t& i) {return safe_distances[i];});
+        case COLUMN::BUFFER:
+            return function([buffers](const std::size_t& i) {return buffers[i];});
+        case COLUMN::VFI_GAIN:
+            return function([vfi_gains](const std::size_t& i) {return vfi_gains[i];});
+        case COLUMN::CLEARANCE:
+            return function([safe_distances, buffers](const std::size_t& i) {return safe_distances[i] + buffers[i];});
+        }
+        throw std::runtime_error("ConstraintColumns: Unknown column!");
+    }
+
+    void _check_mask(const Mask& mask, const std::string& method) const
+    {
+        if (mask.size() != types_.size())
+            throw std::runtime_error("ConstraintColumns::" + method + ": The mask has " + std::to_string(mask.size()) +
+                                     " rows, but the table has " + std::to_string(types_.size()) + "!");
+    }
+};
+
+/*
+ * The kernels below copy the sizes and the column accessors to local variables before their loops.
+ * The masks are arrays of std::uint8_t, which may alias any object, so otherwise the compiler reloads
+ * them after each store and cannot vectorize the loop.
+ */
+template<typename Value, typename Compare>
+static void compare_kernel(const std::size_t size, const Value value, const Compare compare,
+                           const double threshold, std::uint8_t* mask)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        mask[i] = compare(value(i), threshold) ? 1 : 0;
+}
+
+/**
+ * @brief masked_sum uses four partial sums, so that the additions can run in parallel without
+ *        reordering the floating-point operations of each partial sum.
+ */
+template<typename Value>
+static double masked_sum(const std::size_t size, const Value value, const std::uint8_t* mask)
+{
+    double partial[4] = {0.0, 0.0, 0.0, 0.0};
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            const double element = value(i + j);
+            partial[j] += mask[i + j] ? element : 0.0;
+        }
+    for (; i < size; ++i)
+    {
+        const double element = value(i);
+        partial[0] += mask[i] ? element : 0.0;
+    }
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+/**
+ * @brief ConstraintColumns::ConstraintColumns ctor of the class. The table is empty.
+ */
+ConstraintColumns::ConstraintColumns()
+{
+    impl_ = std::make_shared<ConstraintColumns::Impl>();
+}
+
+/**
+ * @brief ConstraintColumns::reserve reserves memory for a number of rows.
+ * @param size The number of rows.
+ */
+void ConstraintColumns::reserve(const std::size_t& size)
+{
+    impl_->types_.reserve(size);
+    impl_->safe_distances_.reserve(size);
+    impl_->buffers_.reserve(size);
+    impl_->vfi_gains_.reserve(size);
+    impl_->robot_indexes_one_.reserve(size);
+    impl_->robot_indexes_two_.reserve(size);
+    impl_->joint_indexes_one_.reserve(size);
+    impl_->joint_indexes_two_.reserve(size);
+    impl_->tags_.reserve(size);
+}
+
+/**
+ * @brief ConstraintColumns::clear removes all the rows.
+ */
+void ConstraintColumns::clear()
+{
+    impl_ = std::make_shared<ConstraintColumns::Impl>();
+}
+
+/**
+ * @brief ConstraintColumns::add_data appends a constraint as a new row.
+ * @param data The constraint.
+ */
+void ConstraintColumns::add_data(const VFIConfigurationFile::Data& data)
+{
+    std::visit([&](auto&& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+            impl_->types_.push_back(TYPE::ENVIRONMENT_TO_ROBOT);
+            impl_->robot_indexes_one_.push_back(arg.robot_index);
+            impl_->robot_indexes_two_.push_back(no_index);
+            impl_->joint_indexes_one_.push_back(arg.joint_index);
+            impl_->joint_indexes_two_.push_back(no_index);
+        } else {
+            impl_->types_.push_back(TYPE::ROBOT_TO_ROBOT);
+            impl_->robot_indexes_one_.push_back(arg.robot_index_one);
+            impl_->robot_indexes_two_.push_back(arg.robot_index_two);
+            impl_->joint_indexes_one_.push_back(arg.joint_index_one);
+            impl_->joint_indexes_two_.push_back(arg.joint_index_two);
+        }
+        impl_->safe_distances_.push_back(arg.safe_distance);
+        impl_->buffers_.push_back(arg.buffer);
+        impl_->vfi_gains_.push_back(arg.vfi_gain);
+        impl_->tags_.push_back(arg.tag);
+    }, data);
+}
+
+/**
+ * @brief ConstraintColumns::add_data appends several constraints, in order.
+ * @param vector_data The constraints.
+ */
+void ConstraintColumns::add_data(const std::vector<VFIConfigurationFile::Data>& vector_data)
+{
+    reserve(size() + vector_data.size());
+    for (const auto& data : vector_data)
+        add_data(data);
+}
+
+std::size_t ConstraintColumns::size() const
+{
+    return impl_->types_.size();
+}
+
+bool ConstraintColumns::empty() const
+{
+    return impl_->types_.empty();
+}
+
+const std::vector<ConstraintColumns::TYPE>& ConstraintColumns::get_types() const
+{
+    return impl_->types_;
+}
+
+const std::vector<double>& ConstraintColumns::get_safe_distances() const
+{
+    return impl_->safe_distances_;
+}
+
+const std::vector<double>& ConstraintColumns::get_buffers() const
+{
+    return impl_->buffers_;
+}
+
+const std::vector<double>& ConstraintColumns::get_vfi_gains() const
+{
+    return impl_->vfi_gains_;
+}
+
+const std::vector<std::int32_t>& ConstraintColumns::get_robot_indexes_one() const
+{
+    return impl_->robot_indexes_one_;
+}
+
+const std::vector<std::int32_t>& ConstraintColumns::get_robot_indexes_two() const
+{
+    return impl_->robot_indexes_two_;
+}
+
+const std::vector<std::int32_t>& ConstraintColumns::get_joint_indexes_one() const
+{
+    return impl_->joint_indexes_one_;
+}
+
+const std::vector<std::int32_t>& ConstraintColumns::get_joint_indexes_two() const
+{
+    return impl_->joint_indexes_two_;
+}
+
+const std::vector<std::string>& ConstraintColumns::get_tags() const
+{
+    return impl_->tags_;
+}
+
+/**
+ * @brief ConstraintColumns::get_tags returns the tags of the selected rows, in row order.
+ * @param mask The selected rows.
+ * @return The desired tags.
+ */
+std::vector<std::string> ConstraintColumns::get_tags(const Mask& mask) const
+{
+    impl_->_check_mask(mask, "get_tags");
+    std::vector<std::string> tags;
+    tags.reserve(count(mask));
+    for (std::size_t i = 0; i < mask.size(); ++i)
+        if (mask[i])
+            tags.push_back(impl_->tags_[i]);
+    return tags;
+}
+
+/**
+ * @brief ConstraintColumns::select selects the rows whose value in a column compares to a threshold.
+ * @param column The column.
+ * @param comparison The comparison, in the order value <comparison> threshold.
+ * @param value The threshold.
+ * @return The mask of the selected rows.
+ */
+ConstraintColumns::Mask ConstraintColumns::select(const COLUMN& column, const COMPARISON& comparison,
+                                                  const double& value) const
+{
+    Mask mask(size());
+    impl_->_with_column(column, [&](const auto& column_value) {
+        switch (comparison)
+        {
+        case COMPARISON::LESS:
+            return compare_kernel(mask.size(), column_value, std::less<double>(), value, mask.data());
+        case COMPARISON::LESS_EQUAL:
+            return compare_kernel(mask.size(), column_value, std::less_equal<double>(), value, mask.data());
+        case COMPARISON::GREATER:
+            return compare_kernel(mask.size(), column_value, std::greater<double>(), value, mask.data());
+        case COMPARISON::GREATER_EQUAL:
+            return compare_kernel(mask.size(), column_value, std::greater_equal<double>(), value, mask.data());
+        }
+        throw std::runtime_error("ConstraintColumns::select: Unknown comparison!");
+    });
+    return mask;
+}
+
+/**
+ * @brief ConstraintColumns::select_type selects the rows of a constraint type.
+ */
+ConstraintColumns::Mask ConstraintColumns::select_type(const TYPE& type) const
+{
+    const std::size_t rows = size();
+    Mask mask(rows);
+    std::uint8_t* selected = mask.data();
+    const TYPE* types = impl_->types_.data();
+    for (std::size_t i = 0; i < rows; ++i)
+        selected[i] = types[i] == type ? 1 : 0;
+    return mask;
+}
+
+/**
+ * @brief ConstraintColumns::select_robot selects the rows that involve a robot, in any of its slots.
+ */
+ConstraintColumns::Mask ConstraintColumns::select_robot(const std::int32_t& robot_index) const
+{
+    const std::size_t rows = size();
+    Mask mask(rows);
+    std::uint8_t* selected = mask.data();
+    const std::int32_t* one = impl_->robot_indexes_one_.data();
+    const std::int32_t* two = impl_->robot_indexes_two_.data();
+    const std::int32_t robot = robot_index;
+    for (std::size_t i = 0; i < rows; ++i)
+        selected[i] = (one[i] == robot) | (two[i] == robot);
+    return mask;
+}
+
+/**
+ * @brief ConstraintColumns::select_joint selects the rows that involve a joint of a robot, in any of
+ *        its slots.
+ */
+ConstraintColumns::Mask ConstraintColumns::select_joint(const std::int32_t& robot_index, const std::int32_t& joint_index) const
+{
+    const std::size_t rows = size();
+    Mask mask(rows);
+    std::uint8_t* selected = mask.data();
+    const std::int32_t robot = robot_index;
+    const std::int32_t joint = joint_index;
+    const std::int32_t* robot_one = impl_->robot_indexes_one_.data();
+    const std::int32_t* robot_two = impl_->robot_indexes_two_.data();
+    const std::int32_t* joint_one = impl_->joint_indexes_one_.data();
+    const std::int32_t* joint_two = impl_->joint_indexes_two_.data();
+    for (std::size_t i = 0; i < rows; ++i)
+        selected[i] = ((robot_one[i] == robot) & (joint_one[i] == joint)) |
+                      ((robot_two[i] == robot) & (joint_two[i] == joint));
+    return mask;
+}
+
+/**
+ * @brief ConstraintColumns::mask_and keeps in mask only the rows that are also selected in other.
+ */
+void ConstraintColumns::mask_and(Mask& mask, const Mask& other)
+{
+    if (mask.size() != other.size())
+        throw std::runtime_error("ConstraintColumns::mask_and: The masks have different sizes!");
+    const std::size_t rows = mask.size();
+    std::uint8_t* selected = mask.data();
+    const std::uint8_t* other_selected = other.data();
+    for (std::size_t i = 0; i < rows; ++i)
+        selected[i] &= other_selected[i];
+}
+
+/**
+ * @brief ConstraintColumns::mask_or adds to mask the rows that are selected in other.
+ */
+void ConstraintColumns::mask_or(Mask& mask, const Mask& other)
+{
+    if (mask.size() != other.size())
+        throw std::runtime_error("ConstraintColumns::mask_or: The masks have different sizes!");
+    const std::size_t rows = mask.size();
+    std::uint8_t* selected = mask.data();
+    const std::uint8_t* other_selected = other.data();
+    for (std::size_t i = 0; i < rows; ++i)
+        selected[i] |= other_selected[i];
+}
+
+/**
+ * @brief ConstraintColumns::count returns the number of selected rows.
+ */
+std::size_t ConstraintColumns::count(const Mask& mask)
+{
+    const std::size_t rows = mask.size();
+    const std::uint8_t* selected = mask.data();
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < rows; ++i)
+        total += selected[i];
+    return total;
+}
+
+/**
+ * @brief ConstraintColumns::sum returns the sum of a column over the selected rows.
+ */
+double ConstraintColumns::sum(const COLUMN& column, const Mask& mask) const
+{
+    impl_->_check_mask(mask, "sum");
+    return impl_->_with_column(column, [&](const auto& value) {
+        return masked_sum(mask.size(), value, mask.data());
+    });
+}
+
+/**
+ * @brief ConstraintColumns::min returns the minimum of a column over the selected rows.
+ * @return The desired value, or NaN if no row is selected.
+ */
+double ConstraintColumns::min(const COLUMN& column, const Mask& mask) const
+{
+    impl_->_check_mask(mask, "min");
+    if (count(mask) == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+    return impl_->_with_column(column, [&](const auto value) {
+        const std::size_t rows = mask.size();
+        const std::uint8_t* selected = mask.data();
+        double result = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            const double element = value(i);
+            result = (selected[i] != 0) & (element < result) ? element : result;
+        }
+        return result;
+    });
+}
+
+/**
+ * @brief ConstraintColumns::max returns the maximum of a column over the selected rows.
+ * @return The desired value, or NaN if no row is selected.
+ */
+double ConstraintColumns::max(const COLUMN& column, const Mask& mask) const
+{
+    impl_->_check_mask(mask, "max");
+    if (count(mask) == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+    return impl_->_with_column(column, [&](const auto value) {
+        const std::size_t rows = mask.size();
+        const std::uint8_t* selected = mask.data();
+        double result = -std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            const double element = value(i);
+            result = (selected[i] != 0) & (element > result) ? element : result;
+        }
+        return result;
+    });
+}
+
+/**
+ * @brief ConstraintColumns::mean returns the mean of a column over the selected rows.
+ * @return The desired value, or NaN if no row is selected.
+ */
+double ConstraintColumns::mean(const COLUMN& column, const Mask& mask) const
+{
+    impl_->_check_mask(mask, "mean");
+    const std::size_t selected = count(mask);
+    if (selected == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+    return sum(column, mask)/static_cast<double>(selected);
+}
+
+}
@@ -0,0 +1,180 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <deque>
+#include <optional>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief The ConstraintHistory class keeps the undo and redo records of the RobotConstraintEditor.
+ *        Instead of snapshots, a record keeps the inverse of the steps of an edit: the tag each touched
+ *        constraint has after the edit, and its data before the edit. Therefore, the cost of an edit
+ *        depends only on the constraints it touches, and not on the size of the store. Undoing a record
+ *        produces, through the same hooks, the record that redoes it.
+ *        The number of records is limited by the history depth; the oldest records are dropped first.
+ *        This class is internal to the library.
+ */
+class ConstraintHistory
+{
+public:
+    /**
+     * @brief The Step struct is the inverse of a change of one constraint. Without a tag, it adds the
+     *        data (the change removed it). Without data, it removes the tag (the change added it).
+     *        Otherwise, it replaces the constraint that has the tag by the data.
+     */
+    struct Step{
+        std::optional<std::string> tag;
+        std::optional<VFIConfigurationFile::Data> data;
+        bool is_batched = false;  // True if it must be applied together with the previous step
+    };
+    using Record = std::vector<Step>;
+
+    enum class MODE{
+        EDIT,  // A new edit, which discards the redo records
+        UNDO,
+        REDO
+    };
+
+    /**
+     * @brief The Scope class groups the steps recorded during its lifetime into a single record.
+     *        Scopes can be nested; only the outermost one stores the record.
+     */
+    class Scope{
+        ConstraintHistory& history_;
+        MODE mode_;
+    public:
+        explicit Scope(ConstraintHistory& history, const MODE& mode = MODE::EDIT)
+            : history_(history), mode_(mode)
+        {
+            ++history_.nesting_;
+        }
+        ~Scope()
+        {
+            history_._end(mode_);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    std::deque<Record> undo_;
+    std::deque<Record> redo_;
+    Record pending_;
+    std::size_t nesting_ = 0;
+    std::size_t depth_ = 100;
+
+    void _end(const MODE& mode)
+    {
+        if (--nesting_ > 0)
+            return;
+        if (!pending_.empty())
+        {
+            if (mode == MODE::UNDO)
+                redo_.push_back(std::move(pending_));
+            else
+            {
+                if (mode == MODE::EDIT)
+                    redo_.clear();
+                undo_.push_back(std::move(pending_));
+            }
+            _trim();
+        }
+        pending_.clear();
+    }
+
+    void _trim()
+    {
+        while (undo_.size() > depth_)
+            undo_.pop_front();
+        while (redo_.size() > depth_)
+            redo_.pop_front();
+    }
+
+public:
+    /**
+     * @brief is_recording returns true if the changes are being recorded, i.e., inside a Scope and
+     *        with a non-zero depth. Check it before copying data for a step.
+     */
+    bool is_recording() const
+    {
+        return nesting_ > 0 && depth_ > 0;
+    }
+
+    void record(Step&& step)
+    {
+        if (is_recording())
+            pending_.push_back(std::move(step));
+    }
+
+    /**
+     * @brief set_depth sets the maximum number of undo (and redo) records. Zero disables the history.
+     */
+    void set_depth(const std::size_t& depth)
+    {
+        depth_ = depth;
+        _trim();
+    }
+
+    std::size_t get_depth() const
+    {
+        return depth_;
+    }
+
+    bool can_undo() const
+    {
+        return !undo_.empty();
+    }
+
+    bool can_redo() const
+    {
+        return !redo_.empty();
+    }
+
+    Record pop_undo()
+    {
+        Record record = std::move(undo_.back());
+        undo_.pop_back();
+        return record;
+    }
+
+    Record pop_redo()
+    {
+        Record record = std::move(redo_.back());
+        redo_.pop_back();
+        return record;
+    }
+
+    void clear()
+    {
+        undo_.clear();
+        redo_.clear();
+    }
+};
+
+}
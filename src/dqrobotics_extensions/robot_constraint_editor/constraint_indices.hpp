@@ -0,0 +1,419 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+
+using IndexKey = std::uint64_t;
+
+/**
+ * @brief The FixedKeySet class holds up to N distinct keys of an entry of a PostingIndex, and the position
+ *        of the entry in the list of each key, without allocating memory.
+ */
+template<std::size_t N>
+class FixedKeySet
+{
+    std::array<IndexKey, N> keys_{};
+    std::array<std::uint32_t, N> positions_{};
+    std::uint8_t size_ = 0;
+public:
+    std::size_t size() const {return size_;}
+    const IndexKey& key(const std::size_t& i) const {return keys_[i];}
+    std::uint32_t& position(const std::size_t& i) {return positions_[i];}
+    const std::uint32_t& position(const std::size_t& i) const {return positions_[i];}
+    void clear() {size_ = 0;}
+
+    /**
+     * @brief add adds a key, unless it is already there.
+     */
+    void add(const IndexKey& key)
+    {
+        for (std::uint8_t i = 0; i < size_; ++i)
+            if (keys_[i] == key)
+                return;
+        keys_[size_++] = key;
+    }
+
+    bool has_same_keys(const FixedKeySet& other) const
+    {
+        if (size_ != other.size_)
+            return false;
+        for (std::uint8_t i = 0; i < size_; ++i)
+            if (keys_[i] != other.keys_[i])
+                return false;
+        return true;
+    }
+};
+
+/**
+ * @brief The KeyList class holds any number of distinct keys of an entry of a PostingIndex, and the
+ *        position of the entry in the list of each key.
+ */
+class KeyList
+{
+    std::vector<std::pair<IndexKey, std::uint32_t>> keys_;  // (key, position), in a single allocation
+public:
+    std::size_t size() const {return keys_.size();}
+    const IndexKey& key(const std::size_t& i) const {return keys_[i].first;}
+    std::uint32_t& position(const std::size_t& i) {return keys_[i].second;}
+    const std::uint32_t& position(const std::size_t& i) const {return keys_[i].second;}
+    void clear() {keys_.clear();}
+
+    /**
+     * @brief add adds a key, unless it is already there.
+     */
+    void add(const IndexKey& key)
+    {
+        for (const auto& existing_key : keys_)
+            if (existing_key.first == key)
+                return;
+        keys_.emplace_back(key, 0);
+    }
+
+    bool has_same_keys(const KeyList& other) const
+    {
+        if (keys_.size() != other.keys_.size())
+            return false;
+        for (std::size_t i = 0; i < keys_.size(); ++i)
+            if (keys_[i].first != other.keys_[i].first)
+                return false;
+        return true;
+    }
+};
+
+/**
+ * @brief The PostingIndex class maps keys to the lists of the store indexes that have them. The keys of
+ *        each entry are held by a KeySet (FixedKeySet or KeyList), with the position of the entry in the list
+ *        of each key, so adding and removing an entry are O(number of keys of the entry). A removed element
+ *        is replaced by the last one of its list, so the lists are not sorted.
+ *        This class is internal to the library.
+ */
+template<typename KeySet>
+class PostingIndex
+{
+    std::unordered_map<IndexKey, std::vector<std::uint32_t>> lists_;
+    std::vector<KeySet> entries_;  // Indexed like the store
+
+    void _remove_from_list(const std::uint32_t& entry, const std::size_t& slot)
+    {
+        const IndexKey key = entries_[entry].key(slot);
+        auto it = lists_.find(key);
+        auto& list = it->second;
+        const std::uint32_t position = entries_[entry].position(slot);
+        const std::uint32_t last = list.back();
+        list[position] = last;
+        list.pop_back();
+        if (last != entry)
+        {
+            KeySet& moved = entries_[last];
+            for (std::size_t i = 0; i < moved.size(); ++i)
+                if (moved.key(i) == key)
+                    moved.position(i) = position;
+        }
+        if (list.empty())
+            lists_.erase(it);
+    }
+
+public:
+    void clear()
+    {
+        lists_.clear();
+        entries_.clear();
+    }
+
+    void reserve(const std::size_t& size)
+    {
+        entries_.reserve(size);
+    }
+
+    /**
+     * @brief insert adds the entry at a store index, which must not be in the index.
+     */
+    void insert(const std::size_t& index, KeySet&& keys)
+    {
+        if (index >= entries_.size())
+            entries_.resize(index + 1);
+        KeySet& entry = entries_[index];
+        entry = std::move(keys);
+        for (std::size_t i = 0; i < entry.size(); ++i)
+        {
+            auto& list = lists_[entry.key(i)];
+            entry.position(i) = static_cast<std::uint32_t>(list.size());
+            list.push_back(static_cast<std::uint32_t>(index));
+        }
+    }
+
+    /**
+     * @brief erase removes the entry at a store index.
+     */
+    void erase(const std::size_t& index)
+    {
+        for (std::size_t i = 0; i < entries_[index].size(); ++i)
+            _remove_from_list(static_cast<std::uint32_t>(index), i);
+        entries_[index].clear();
+        if (index + 1 == entries_.size())
+            entries_.pop_back();
+    }
+
+    /**
+     * @brief update changes the keys of the entry at a store index.
+     */
+    void update(const std::size_t& index, KeySet&& keys)
+    {
+        if (entries_[index].has_same_keys(keys))
+            return;
+        erase(index);
+        insert(index, std::move(keys));
+    }
+
+    /**
+     * @brief move moves the last entry to a free store index, as done by ConstraintStore::erase().
+     */
+    void move(const std::size_t& from, const std::size_t& to)
+    {
+        KeySet& entry = entries_[from];
+        for (std::size_t i = 0; i < entry.size(); ++i)
+            lists_[entry.key(i)][entry.position(i)] = static_cast<std::uint32_t>(to);
+        entries_[to] = std::move(entry);
+        entries_.pop_back();
+    }
+
+    /**
+     * @brief find returns the store indexes of the entries with a key, or nullptr if there is none.
+     */
+    const std::vector<std::uint32_t>* find(const IndexKey& key) const
+    {
+        const auto it = lists_.find(key);
+        return it == lists_.end() ? nullptr : &it->second;
+    }
+};
+
+/**
+ * @brief The ConstraintIndices class keeps the secondary indices of the RobotConstraintEditor: by robot
+ *        index, by (robot index, joint index), by vfi_type, by direction and by the entity names in the
+ *        cs_entity lists. The entries of the indices are store indexes, so the editor must report every
+ *        change of the store.
+ *        This class is internal to the library.
+ */
+class ConstraintIndices
+{
+    using Keys = FixedKeySet<2>;
+
+    PostingIndex<Keys> robots_;
+    PostingIndex<Keys> joints_;
+    PostingIndex<Keys> vfi_types_;
+    PostingIndex<Keys> directions_;
+    PostingIndex<KeyList> entities_;
+    std::unordered_map<std::string, IndexKey> symbols_;  // vfi_type, direction and entity names
+
+    static IndexKey _robot_key(const int& robot_index)
+    {
+        return static_cast<std::uint32_t>(robot_index);
+    }
+
+    static IndexKey _joint_key(const int& robot_index, const int& joint_index)
+    {
+        return (static_cast<IndexKey>(static_cast<std::uint32_t>(robot_index)) << 32) |
+               static_cast<std::uint32_t>(joint_index);
+    }
+
+    IndexKey _symbol_key(const std::string& value)
+    {
+        return symbols_.try_emplace(value, symbols_.size()).first->second;
+    }
+
+    void _add_entities(KeyList& keys, const std::vector<std::string>& entities)
+    {
+        for (const auto& entity : entities)
+            keys.add(_symbol_key(entity));
+    }
+
+    /**
+     * @brief _keys computes the keys of a constraint in the fixed-size indices.
+     */
+    std::array<Keys, 4> _keys(const VFIConfigurationFile::Data& data)
+    {
+        std::array<Keys, 4> keys;
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                keys[0].add(_robot_key(arg.robot_index));
+                keys[1].add(_joint_key(arg.robot_index, arg.joint_index));
+            } else {
+                keys[0].add(_robot_key(arg.robot_index_one));
+                keys[0].add(_robot_key(arg.robot_index_two));
+                keys[1].add(_joint_key(arg.robot_index_one, arg.joint_index_one));
+                keys[1].add(_joint_key(arg.robot_index_two, arg.joint_index_two));
+            }
+            keys[2].add(_symbol_key(arg.vfi_type));
+            keys[3].add(_symbol_key(arg.direction));
+        }, data);
+        return keys;
+    }
+
+    /**
+     * @brief _entity_keys computes the keys of a constraint in the entity index.
+     */
+    KeyList _entity_keys(const VFIConfigurationFile::Data& data)
+    {
+        KeyList keys;
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                _add_entities(keys, arg.cs_entity_environment);
+                _add_entities(keys, arg.cs_entity_robot);
+            } else {
+                _add_entities(keys, arg.cs_entity_one);
+                _add_entities(keys, arg.cs_entity_two);
+            }
+        }, data);
+        return keys;
+    }
+
+    template<typename KeySet>
+    const std::vector<std::uint32_t>* _find_symbol(const PostingIndex<KeySet>& index, const std::string& value) const
+    {
+        const auto it = symbols_.find(value);
+        return it == symbols_.end() ? nullptr : index.find(it->second);
+    }
+
+public:
+    /**
+     * @brief is_indexed_key checks if a field is used by the indices. Edits of the other fields do not
+     *        need to update the indices.
+     */
+    static bool is_indexed_key(const std::string_view& key)
+    {
+        for (const char* indexed_key : {"robot_index", "joint_index", "robot_index_one", "robot_index_two",
+                                        "joint_index_one", "joint_index_two", "vfi_type", "direction",
+                                        "cs_entity_environment", "cs_entity_robot", "cs_entity_one",
+                                        "cs_entity_two"})
+            if (key == indexed_key)
+                return true;
+        return false;
+    }
+
+    void clear()
+    {
+        robots_.clear();
+        joints_.clear();
+        vfi_types_.clear();
+        directions_.clear();
+        entities_.clear();
+        symbols_.clear();
+    }
+
+    void reserve(const std::size_t& size)
+    {
+        robots_.reserve(size);
+        joints_.reserve(size);
+        vfi_types_.reserve(size);
+        directions_.reserve(size);
+        entities_.reserve(size);
+    }
+
+    void insert(const std::size_t& index, const VFIConfigurationFile::Data& data)
+    {
+        auto keys = _keys(data);
+        robots_.insert(index, std::move(keys[0]));
+        joints_.insert(index, std::move(keys[1]));
+        vfi_types_.insert(index, std::move(keys[2]));
+        directions_.insert(index, std::move(keys[3]));
+        entities_.insert(index, _entity_keys(data));
+    }
+
+    void update(const std::size_t& index, const VFIConfigurationFile::Data& data)
+    {
+        auto keys = _keys(data);
+        robots_.update(index, std::move(keys[0]));
+        joints_.update(index, std::move(keys[1]));
+        vfi_types_.update(index, std::move(keys[2]));
+        directions_.update(index, std::move(keys[3]));
+        entities_.update(index, _entity_keys(data));
+    }
+
+    /**
+     * @brief erase removes the entry at a store index. If the store moved its last entry to that index,
+     *        call move() afterwards.
+     */
+    void erase(const std::size_t& index)
+    {
+        robots_.erase(index);
+        joints_.erase(index);
+        vfi_types_.erase(index);
+        directions_.erase(index);
+        entities_.erase(index);
+    }
+
+    void move(const std::size_t& from, const std::size_t& to)
+    {
+        robots_.move(from, to);
+        joints_.move(from, to);
+        vfi_types_.move(from, to);
+        directions_.move(from, to);
+        entities_.move(from, to);
+    }
+
+    const std::vector<std::uint32_t>* find_robot(const int& robot_index) const
+    {
+        return robots_.find(_robot_key(robot_index));
+    }
+
+    const std::vector<std::uint32_t>* find_joint(const int& robot_index, const int& joint_index) const
+    {
+        return joints_.find(_joint_key(robot_index, joint_index));
+    }
+
+    const std::vector<std::uint32_t>* find_vfi_type(const std::string& vfi_type) const
+    {
+        return _find_symbol(vfi_types_, vfi_type);
+    }
+
+    const std::vector<std::uint32_t>* find_direction(const std::string& direction) const
+    {
+        return _find_symbol(directions_, direction);
+    }
+
+    /**
+     * @brief find_entity returns the store indexes of the constraints with an entity name in any of
+     *        their cs_entity lists, or nullptr if there is none.
+     */
+    const std::vector<std::uint32_t>* find_entity(const std::string& entity) const
+    {
+        return _find_symbol(entities_, entity);
+    }
+};
+
+}
@@ -0,0 +1,438 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include "constraint_journal.hpp"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+namespace DQ_robotics_extensions
+{
+
+namespace
+{
+constexpr char MAGIC[4] = {'V', 'F', 'I', 'J'};
+constexpr std::uint32_t FORMAT_VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+struct Header{
+    char magic[4];
+    std::uint32_t format_version;
+    std::uint32_t byte_order;
+    std::uint32_t reserved;
+    std::uint64_t base_size;
+    std::int64_t base_modification_time;
+};
+
+struct EntryHeader{
+    std::uint32_t size;
+    std::uint32_t checksum;
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 32, "Unexpected Header layout");
+static_assert(std::is_trivially_copyable_v<EntryHeader> && sizeof(EntryHeader) == 8, "Unexpected EntryHeader layout");
+
+std::uint32_t _checksum(const char* data, const std::size_t& size)
+{
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template<typename T>
+void _put(std::string& buffer, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void _put_string(std::string& buffer, const std::string& value)
+{
+    _put(buffer, static_cast<std::uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+void _put_strings(std::string& buffer, const std::vector<std::string>& values)
+{
+    _put(buffer, static_cast<std::uint32_t>(values.size()));
+    for (const auto& value : values)
+        _put_string(buffer, value);
+}
+
+/**
+ * @brief The Reader class reads the fields of a payload. Reading past its end throws a std::runtime_error.
+ */
+class Reader
+{
+    const char* position_;
+    const char* end_;
+
+    void _check(const std::size_t& size)
+    {
+        if (static_cast<std::size_t>(end_ - position_) < size)
+            throw std::runtime_error("ConstraintJournal: Truncated entry!");
+    }
+
+public:
+    Reader(const char* data, const std::size_t& size) : position_(data), end_(data + size) {}
+
+    template<typename T>
+    T get()
+    {
+        T value;
+        _check(sizeof(T));
+        std::memcpy(&value, position_, sizeof(T));
+        position_ += sizeof(T);
+        return value;
+    }
+
+    std::string get_string()
+    {
+        const auto size = get<std::uint32_t>();
+        _check(size);
+        std::string value(position_, size);
+        position_ += size;
+        return value;
+    }
+
+    std::vector<std::string> get_strings()
+    {
+        std::vector<std::string> values(get<std::uint32_t>());
+        for (auto& value : values)
+            value = get_string();
+        return values;
+    }
+};
+
+/**
+ * @brief _read_upsert reads a constraint in the layout written by ConstraintJournal::append_upsert().
+ */
+ConstraintJournal::Data _read_upsert(Reader& reader)
+{
+    const auto type = reader.get<std::uint8_t>();
+    auto read_base = [&](VFIConfigurationFile::BASE_DATA& base) {
+        base.vfi_type = reader.get_string();
+        base.direction = reader.get_string();
+        base.tag = reader.get_string();
+        base.safe_distance = reader.get<double>();
+        base.buffer = reader.get<double>();
+        base.vfi_gain = reader.get<double>();
+    };
+    if (type == 0)
+    {
+        VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA env_data;
+        read_base(env_data);
+        env_data.cs_entity_environment = reader.get_strings();
+        env_data.cs_entity_robot = reader.get_strings();
+        env_data.entity_environment_primitive_type = reader.get_string();
+        env_data.entity_robot_primitive_type = reader.get_string();
+        env_data.robot_index = reader.get<std::int32_t>();
+        env_data.joint_index = reader.get<std::int32_t>();
+        return env_data;
+    }
+    if (type != 1)
+        throw std::runtime_error("ConstraintJournal: Unknown constraint type!");
+    VFIConfigurationFile::ROBOT_TO_ROBOT_DATA robot_data;
+    read_base(robot_data);
+    robot_data.cs_entity_one = reader.get_strings();
+    robot_data.cs_entity_two = reader.get_strings();
+    robot_data.entity_one_primitive_type = reader.get_string();
+    robot_data.entity_two_primitive_type = reader.get_string();
+    robot_data.robot_index_one = reader.get<std::int32_t>();
+    robot_data.robot_index_two = reader.get<std::int32_t>();
+    robot_data.joint_index_one = reader.get<std::int32_t>();
+    robot_data.joint_index_two = reader.get<std::int32_t>();
+    return robot_data;
+}
+
+const std::string& _tag_of(const ConstraintJournal::Data& data)
+{
+    return std::visit([](auto&& arg) -> const std::string& {
+        return arg.tag;
+    }, data);
+}
+
+}
+
+/**
+ * @brief ConstraintJournal::path_of returns the path of a journal of a base file.
+ * @param base_file The path of the base file.
+ * @param extension The extension of the journal (e.g. ".delta").
+ */
+std::string ConstraintJournal::path_of(const std::string& base_file, const std::string& extension)
+{
+    return std::string(base_file).append(extension);
+}
+
+/**
+ * @brief ConstraintJournal::get_fingerprint returns the size and the modification time of a base file.
+ *        Throws a std::runtime_error if the file does not exist.
+ */
+ConstraintJournal::Fingerprint ConstraintJournal::get_fingerprint(const std::string& base_file)
+{
+    Fingerprint fingerprint;
+    fingerprint.size = std::filesystem::file_size(base_file);
+    fingerprint.modification_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::filesystem::last_write_time(base_file).time_since_epoch()).count();
+    return fingerprint;
+}
+
+/**
+ * @brief ConstraintJournal::append_upsert encodes an entry that adds a constraint, or replaces the
+ *        constraint with the same tag.
+ * @param entries The buffer where the entry is appended.
+ * @param data The constraint.
+ */
+void ConstraintJournal::append_upsert(std::string& entries, const Data& data)
+{
+    const std::size_t start = entries.size();
+    _put(entries, EntryHeader{});
+    _put(entries, OPERATION::UPSERT);
+    std::visit([&](auto&& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        _put(entries, static_cast<std::uint8_t>(std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA> ? 0 : 1));
+        _put_string(entries, arg.vfi_type);
+        _put_string(entries, arg.direction);
+        _put_string(entries, arg.tag);
+        _put(entries, arg.safe_distance);
+        _put(entries, arg.buffer);
+        _put(entries, arg.vfi_gain);
+        if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+            _put_strings(entries, arg.cs_entity_environment);
+            _put_strings(entries, arg.cs_entity_robot);
+            _put_string(entries, arg.entity_environment_primitive_type);
+            _put_string(entries, arg.entity_robot_primitive_type);
+            _put(entries, static_cast<std::int32_t>(arg.robot_index));
+            _put(entries, static_cast<std::int32_t>(arg.joint_index));
+        } else {
+            _put_strings(entries, arg.cs_entity_one);
+            _put_strings(entries, arg.cs_entity_two);
+            _put_string(entries, arg.entity_one_primitive_type);
+            _put_string(entries, arg.entity_two_primitive_type);
+            _put(entries, static_cast<std::int32_t>(arg.robot_index_one));
+            _put(entries, static_cast<std::int32_t>(arg.robot_index_two));
+            _put(entries, static_cast<std::int32_t>(arg.joint_index_one));
+            _put(entries, static_cast<std::int32_t>(arg.joint_index_two));
+        }
+    }, data);
+    const std::size_t payload = start + sizeof(EntryHeader);
+    const EntryHeader header{static_cast<std::uint32_t>(entries.size() - payload),
+                             _checksum(entries.data() + payload, entries.size() - payload)};
+    std::memcpy(entries.data() + start, &header, sizeof(header));
+}
+
+/**
+ * @brief ConstraintJournal::append_remove encodes an entry that removes the constraint with a tag, if any.
+ * @param entries The buffer where the entry is appended.
+ * @param tag The tag of the constraint.
+ */
+void ConstraintJournal::append_remove(std::string& entries, const std::string& tag)
+{
+    const std::size_t start = entries.size();
+    _put(entries, EntryHeader{});
+    _put(entries, OPERATION::REMOVE);
+    _put_string(entries, tag);
+    const std::size_t payload = start + sizeof(EntryHeader);
+    const EntryHeader header{static_cast<std::uint32_t>(entries.size() - payload),
+                             _checksum(entries.data() + payload, entries.size() - payload)};
+    std::memcpy(entries.data() + start, &header, sizeof(header));
+}
+
+/**
+ * @brief ConstraintJournal::write writes encoded entries to a journal.
+ * @param path The path of the journal.
+ * @param fingerprint The fingerprint of the base file, written in the header of a new journal.
+ * @param entries The entries, encoded with append_upsert() and append_remove().
+ * @param append True to add the entries to the end of the existing journal. False to replace it with a
+ *        new journal (atomically).
+ * @param sync_policy When the journal is flushed to the storage device.
+ */
+void ConstraintJournal::write(const std::string& path,
+                              const Fingerprint& fingerprint,
+                              const std::string& entries,
+                              const bool& append,
+                              const FileWriter::SYNC_POLICY& sync_policy)
+{
+    FileWriter writer(append ? FileWriter::SAVE_MODE::APPEND : FileWriter::SAVE_MODE::ATOMIC, sync_policy);
+    writer.open(path);
+    try {
+        if (!append)
+        {
+            Header header{};
+            std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+            header.format_version = FORMAT_VERSION;
+            header.byte_order = BYTE_ORDER_MARK;
+            header.base_size = fingerprint.size;
+            header.base_modification_time = fingerprint.modification_time;
+            writer.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        writer.write(entries.data(), entries.size());
+        writer.commit();
+    } catch (...) {
+        writer.discard();
+        throw;
+    }
+}
+
+/**
+ * @brief ConstraintJournal::read applies the entries of a journal to a vector of constraints: an UPSERT
+ *        replaces the constraint with the same tag or adds the constraint at the end, and a REMOVE
+ *        removes the constraint with the tag. The reading stops at the first entry that is incomplete
+ *        or corrupted (e.g. by a crash while writing it). The journal is not modified: a writer must
+ *        truncate() it to the valid size before appending to it.
+ * @param path The path of the journal.
+ * @param fingerprint The fingerprint of the base file. If it does not match the journal, the journal
+ *        is not applied.
+ * @param data The constraints of the base file.
+ * @return The description of the applied entries.
+ */
+ConstraintJournal::ReadResult ConstraintJournal::read(const std::string& path,
+                                                      const Fingerprint& fingerprint,
+                                                      std::vector<Data>& data)
+{
+    ReadResult result;
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return result;
+    const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    Header header;
+    if (contents.size() < sizeof(Header))
+        return result;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error(std::string("ConstraintJournal::read: Not a journal: ").append(path));
+    if (header.format_version != FORMAT_VERSION || header.byte_order != BYTE_ORDER_MARK)
+        throw std::runtime_error(std::string("ConstraintJournal::read: Unsupported journal: ").append(path));
+    if (header.base_size != fingerprint.size || header.base_modification_time != fingerprint.modification_time)
+        return result;
+    result.is_valid = true;
+
+    // The last entry of each tag wins. The tags are kept in the order of their first entry.
+    std::unordered_map<std::string, std::size_t> last_entry;
+    std::vector<std::pair<std::string, Data>> entries;  // Tag and the constraint of an UPSERT
+    std::vector<bool> is_removed;
+    std::size_t position = sizeof(Header);
+    while (contents.size() - position >= sizeof(EntryHeader))
+    {
+        EntryHeader entry_header;
+        std::memcpy(&entry_header, contents.data() + position, sizeof(entry_header));
+        const char* payload = contents.data() + position + sizeof(EntryHeader);
+        if (contents.size() - position - sizeof(EntryHeader) < entry_header.size ||
+            _checksum(payload, entry_header.size) != entry_header.checksum)
+            break;
+        Reader reader(payload, entry_header.size);
+        std::string tag;
+        Data item;
+        bool removed = false;
+        try {
+            const auto operation = reader.get<OPERATION>();
+            if (operation == OPERATION::UPSERT)
+            {
+                item = _read_upsert(reader);
+                tag = _tag_of(item);
+            }
+            else if (operation == OPERATION::REMOVE)
+            {
+                tag = reader.get_string();
+                removed = true;
+            }
+            else
+                break;
+        } catch (const std::runtime_error&) {
+            break;
+        }
+        const auto [it, inserted] = last_entry.try_emplace(tag, entries.size());
+        if (inserted)
+        {
+            entries.emplace_back(std::move(tag), std::move(item));
+            is_removed.push_back(removed);
+        }
+        else
+        {
+            entries[it->second].second = std::move(item);
+            is_removed[it->second] = removed;
+        }
+        position += sizeof(EntryHeader) + entry_header.size;
+        ++result.number_of_entries;
+    }
+    result.valid_size = position;
+
+    // Apply the last entry of each tag to the base constraints
+    std::vector<bool> is_applied(entries.size(), false);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        const auto it = last_entry.find(_tag_of(data[i]));
+        if (it != last_entry.end())
+        {
+            is_applied[it->second] = true;
+            if (is_removed[it->second])
+                continue;
+            data[i] = std::move(entries[it->second].second);
+        }
+        if (kept != i)
+            data[kept] = std::move(data[i]);
+        ++kept;
+    }
+    data.resize(kept);
+    for (std::size_t i = 0; i < entries.size(); ++i)
+        if (!is_applied[i] && !is_removed[i])
+            data.push_back(std::move(entries[i].second));
+    return result;
+}
+
+/**
+ * @brief ConstraintJournal::truncate removes the bytes after the valid entries of a journal (e.g. an entry
+ *        torn by a crash), so that later entries can be appended after the valid ones.
+ * @param path The path of the journal.
+ * @param valid_size The bytes of the header and of the valid entries (see ReadResult).
+ */
+void ConstraintJournal::truncate(const std::string& path, const std::uint64_t& valid_size)
+{
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    if (!error && size > valid_size)
+        std::filesystem::resize_file(path, valid_size);
+}
+
+/**
+ * @brief ConstraintJournal::remove removes a journal, if it exists.
+ */
+void ConstraintJournal::remove(const std::string& path)
+{
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/file_writer.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The ConstraintJournal class reads and writes append-only files of constraint changes, which are
+ *        replayed on top of a base file (a configuration file saved by a VFIConfigurationFile).
+ *
+ *  [Header]                          magic, format version, byte order and the fingerprint of the base file
+ *  [uint32_t size][uint32_t checksum][payload of size bytes]    one entry per change
+ *
+ * A payload is an OPERATION followed by a whole constraint (UPSERT) or by a tag (REMOVE). Every entry
+ * is idempotent, so replaying a journal twice gives the same result. The checksum (FNV-1a) of each payload
+ * lets read() stop at an entry that was partially written by a crash.
+ * The journal only applies to the base file it was started for: its header records the size and the
+ * modification time of that file, and the journal is ignored if they no longer match.
+ * This class is internal to the library.
+ */
+class ConstraintJournal
+{
+public:
+    using Data = VFIConfigurationFile::Data;
+
+    enum class OPERATION : std::uint8_t{
+        UPSERT = 1,
+        REMOVE = 2
+    };
+
+    /**
+     * @brief The Fingerprint struct identifies a version of the base file.
+     */
+    struct Fingerprint{
+        std::uint64_t size = 0;
+        std::int64_t modification_time = 0;  // Nanoseconds
+        bool operator==(const Fingerprint& other) const
+        {
+            return size == other.size && modification_time == other.modification_time;
+        }
+    };
+
+    /**
+     * @brief The ReadResult struct describes the entries returned by read().
+     */
+    struct ReadResult{
+        bool is_valid = false;              // False if there is no journal, or it is for another base file
+        std::size_t number_of_entries = 0;  // Valid entries
+        std::uint64_t valid_size = 0;       // Bytes of the header and of the valid entries
+    };
+
+    static std::string path_of(const std::string& base_file, const std::string& extension);
+    static Fingerprint get_fingerprint(const std::string& base_file);
+
+    static void append_upsert(std::string& entries, const Data& data);
+    static void append_remove(std::string& entries, const std::string& tag);
+
+    static void write(const std::string& path,
+                      const Fingerprint& fingerprint,
+                      const std::string& entries,
+                      const bool& append,
+                      const FileWriter::SYNC_POLICY& sync_policy);
+    static ReadResult read(const std::string& path, const Fingerprint& fingerprint, std::vector<Data>& data);
+    static void truncate(const std::string& path, const std::uint64_t& valid_size);
+    static void remove(const std::string& path);
+};
+
+}
@@ -0,0 +1,150 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_snapshot.hpp>
+#include <algorithm>
+#include "constraint_snapshot_builder.hpp"
+
+namespace DQ_robotics_extensions
+{
+
+class ConstraintSnapshot::Impl
+{
+public:
+    std::uint64_t version_ = 0;
+    std::size_t size_ = 0;
+    std::vector<std::shared_ptr<const ConstraintSnapshotBuilder::Chunk>> chunks_;
+
+    template<typename Function>
+    void for_each(Function&& function) const
+    {
+        for (const auto& chunk : chunks_)
+            for (const auto& data : *chunk)
+                function(data);
+    }
+};
+
+/**
+ * @brief ConstraintSnapshot::ConstraintSnapshot ctor of the class. The snapshot is empty.
+ */
+ConstraintSnapshot::ConstraintSnapshot()
+{
+    impl_ = std::make_shared<const ConstraintSnapshot::Impl>();
+}
+
+/**
+ * @brief ConstraintSnapshot::get_version returns the version of the editor data in the snapshot. The
+ *        version changes with every modification of the editor.
+ */
+std::uint64_t ConstraintSnapshot::get_version() const
+{
+    return impl_->version_;
+}
+
+std::size_t ConstraintSnapshot::size() const
+{
+    return impl_->size_;
+}
+
+bool ConstraintSnapshot::empty() const
+{
+    return impl_->size_ == 0;
+}
+
+/**
+ * @brief ConstraintSnapshot::get_data returns a copy of the data sorted by tag, like
+ *        RobotConstraintEditor::get_data().
+ */
+std::vector<VFIConfigurationFile::Data> ConstraintSnapshot::get_data() const
+{
+    std::vector<const VFIConfigurationFile::Data*> ordered;
+    ordered.reserve(impl_->size_);
+    impl_->for_each([&](const VFIConfigurationFile::Data& data) {
+        ordered.push_back(&data);
+    });
+    std::sort(ordered.begin(), ordered.end(), [](const auto* a, const auto* b) {
+        return ConstraintStore::tag_of(*a) < ConstraintStore::tag_of(*b);
+    });
+    std::vector<VFIConfigurationFile::Data> data;
+    data.reserve(ordered.size());
+    for (const auto* item : ordered)
+        data.push_back(*item);
+    return data;
+}
+
+/**
+ * @brief ConstraintSnapshot::find_data searches a tag in the snapshot. The search is linear, since the
+ *        snapshot does not keep a hash table.
+ * @param tag The tag to find.
+ * @return A pointer to the data, valid while the snapshot (or a copy) exists, or nullptr if the tag is not found.
+ */
+const VFIConfigurationFile::Data* ConstraintSnapshot::find_data(const std::string& tag) const
+{
+    for (const auto& chunk : impl_->chunks_)
+        for (const auto& data : *chunk)
+            if (ConstraintStore::tag_of(data) == tag)
+                return &data;
+    return nullptr;
+}
+
+/**
+ * @brief ConstraintSnapshot::visit_data calls a function for each constraint, in storage order.
+ * @param visitor The function to call.
+ */
+void ConstraintSnapshot::visit_data(const std::function<void(const VFIConfigurationFile::Data&)>& visitor) const
+{
+    impl_->for_each(visitor);
+}
+
+/**
+ * @brief ConstraintSnapshotBuilder::build creates a snapshot of the store. Only the chunks marked since
+ *        the previous call are copied from the store.
+ * @param store The store.
+ * @param version The version of the data.
+ * @return The snapshot.
+ */
+ConstraintSnapshot ConstraintSnapshotBuilder::build(const ConstraintStore& store, const std::uint64_t& version)
+{
+    const std::size_t number_of_chunks = (store.size() + chunk_size - 1)/chunk_size;
+    chunks_.resize(number_of_chunks);
+    for (const auto& chunk : dirty_chunks_)
+    {
+        is_dirty_[chunk] = 0;
+        if (chunk >= number_of_chunks)
+            continue;
+        const std::size_t begin = chunk*chunk_size;
+        const std::size_t end = std::min(begin + chunk_size, store.size());
+        chunks_[chunk] = std::make_shared<const Chunk>(store.data() + begin, store.data() + end);
+    }
+    dirty_chunks_.clear();
+
+    auto impl = std::make_shared<ConstraintSnapshot::Impl>();
+    impl->version_ = version;
+    impl->size_ = store.size();
+    impl->chunks_ = chunks_;
+    ConstraintSnapshot snapshot;
+    snapshot.impl_ = std::move(impl);
+    return snapshot;
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_snapshot.hpp>
+#include "constraint_store.hpp"
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief The ConstraintSnapshotBuilder class builds the ConstraintSnapshots of the RobotConstraintEditor.
+ *        The snapshot data is split in chunks of consecutive store indexes, which are immutable once
+ *        built and shared by the snapshots. Like ConstraintChanges, the builder must be told about every
+ *        change of the store (including the moves done by ConstraintStore::erase()), so that a new
+ *        snapshot copies only the chunks that changed since the previous one, plus the list of chunks.
+ *        This class is internal to the library.
+ */
+class ConstraintSnapshotBuilder
+{
+public:
+    static constexpr std::size_t chunk_size = 64;
+    using Chunk = std::vector<VFIConfigurationFile::Data>;
+
+private:
+    std::vector<std::shared_ptr<const Chunk>> chunks_;
+    std::vector<std::uint8_t> is_dirty_;  // One flag per chunk
+    std::vector<std::uint32_t> dirty_chunks_;
+
+public:
+    /**
+     * @brief mark records that the constraint at a store index was added, modified, moved or removed.
+     */
+    void mark(const std::size_t& index)
+    {
+        const std::size_t chunk = index/chunk_size;
+        if (chunk >= is_dirty_.size())
+            is_dirty_.resize(chunk + 1, 0);
+        if (!is_dirty_[chunk])
+        {
+            is_dirty_[chunk] = 1;
+            dirty_chunks_.push_back(static_cast<std::uint32_t>(chunk));
+        }
+    }
+
+    ConstraintSnapshot build(const ConstraintStore& store, const std::uint64_t& version);
+};
+
+}
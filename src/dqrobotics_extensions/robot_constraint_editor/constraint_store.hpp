@@ -0,0 +1,351 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    RobotConstraintEditor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    RobotConstraintEditor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with RobotConstraintEditor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file.hpp>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief The ConstraintStore class stores the constraints of the RobotConstraintEditor in a contiguous
+ *        array, indexed by tag with a flat open-addressing hash table (linear probing with backward-shift
+ *        deletion, so there are no tombstones).
+ *        Removing an entry moves the last entry into its place, so the storage order is not stable.
+ *        The deterministic order used to output the data is the tag order, as given by ordered().
+ *        The arrays of the store are allocated from a std::pmr::memory_resource (the default resource
+ *        if none is given).
+ *        This class is internal to the library.
+ */
+class ConstraintStore
+{
+public:
+    using Data = VFIConfigurationFile::Data;
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief tag_of returns a reference to the tag of a constraint.
+     */
+    static const std::string& tag_of(const Data& data)
+    {
+        return std::visit([](auto&& arg) -> const std::string& {
+            return arg.tag;
+        }, data);
+    }
+
+private:
+    static constexpr std::uint32_t empty_slot_ = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot{
+        std::uint32_t index = empty_slot_;  // Index in entries_
+        std::uint32_t hash = 0;             // Low bits of the hash, to skip most string comparisons
+    };
+
+    std::pmr::vector<Data> entries_;
+    std::pmr::vector<std::size_t> hashes_;     // Hash of the tag of each entry
+    std::pmr::vector<Slot> slots_;             // The size is zero or a power of two
+    std::size_t mask_ = 0;
+
+    mutable std::pmr::vector<std::uint32_t> ordered_;
+    mutable bool ordered_is_valid_ = true;
+
+    static std::size_t _hash(const std::string& tag)
+    {
+        return std::hash<std::string>{}(tag);
+    }
+
+    /**
+     * @brief _find_slot finds the slot of a tag.
+     * @return The index of the slot, or npos if the tag is not stored.
+     */
+    std::size_t _find_slot(const std::string& tag, const std::size_t& hash) const
+    {
+        if (slots_.empty())
+            return npos;
+        for (std::size_t i = hash & mask_;; i = (i + 1) & mask_)
+        {
+            const Slot& slot = slots_[i];
+            if (slot.index == empty_slot_)
+                return npos;
+            if (slot.hash == static_cast<std::uint32_t>(hash) && hashes_[slot.index] == hash &&
+                tag_of(entries_[slot.index]) == tag)
+                return i;
+        }
+    }
+
+    void _insert_slot(const std::uint32_t& index, const std::size_t& hash)
+    {
+        std::size_t i = hash & mask_;
+        while (slots_[i].index != empty_slot_)
+            i = (i + 1) & mask_;
+        slots_[i].index = index;
+        slots_[i].hash = static_cast<std::uint32_t>(hash);
+    }
+
+    /**
+     * @brief _erase_slot empties a slot and shifts back the entries of its probe sequence.
+     */
+    void _erase_slot(std::size_t i)
+    {
+        for (std::size_t j = (i + 1) & mask_; slots_[j].index != empty_slot_; j = (j + 1) & mask_)
+        {
+            const std::size_t home = hashes_[slots_[j].index] & mask_;
+            // Move slot j to the hole if its home position is not in the cyclic interval (i, j]
+            if (((j - home) & mask_) >= ((j - i) & mask_)) {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i] = Slot();
+    }
+
+    void _rehash(const std::size_t& capacity)
+    {
+        std::size_t size = 16;
+        while (size < capacity)
+            size <<= 1;
+        slots_.assign(size, Slot());
+        mask_ = size - 1;
+        for (std::size_t index = 0; index < entries_.size(); ++index)
+            _insert_slot(static_cast<std::uint32_t>(index), hashes_[index]);
+    }
+
+    void _grow_if_needed()
+    {
+        // Keep the load factor below 0.5
+        if (2*(entries_.size() + 1) > slots_.size())
+            _rehash(4*(entries_.size() + 1));
+    }
+
+public:
+    explicit ConstraintStore(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource())
+        : entries_(memory_resource), hashes_(memory_resource), slots_(memory_resource), ordered_(memory_resource)
+    {
+
+    }
+
+    std::size_t size() const
+    {
+        return entries_.size();
+    }
+
+    bool empty() const
+    {
+        return entries_.empty();
+    }
+
+    void reserve(const std::size_t& capacity)
+    {
+        entries_.reserve(capacity);
+        hashes_.reserve(capacity);
+        if (2*capacity > slots_.size())
+            _rehash(2*capacity);
+    }
+
+    void clear()
+    {
+        entries_.clear();
+        hashes_.clear();
+        slots_.clear();
+        mask_ = 0;
+        ordered_.clear();
+        ordered_is_valid_ = true;
+    }
+
+    /**
+     * @brief find returns the index of the constraint with a given tag.
+     * @return The index of the constraint, or npos if the tag is not stored.
+     */
+    std::size_t find(const std::string& tag) const
+    {
+        const std::size_t slot = _find_slot(tag, _hash(tag));
+        return slot == npos ? npos : slots_[slot].index;
+    }
+
+    bool contains(const std::string& tag) const
+    {
+        return find(tag) != npos;
+    }
+
+    /**
+     * @brief data returns the array of the constraints, in storage order.
+     */
+    const Data* data() const
+    {
+        return entries_.data();
+    }
+
+    Data& operator[](const std::size_t& index)
+    {
+        return entries_[index];
+    }
+
+    const Data& operator[](const std::size_t& index) const
+    {
+        return entries_[index];
+    }
+
+    /**
+     * @brief insert adds a constraint if its tag is not stored yet.
+     * @return True if the constraint was added. False if the tag is already stored.
+     */
+    bool insert(const Data& data)
+    {
+        return _insert(data);
+    }
+
+    bool insert(Data&& data)
+    {
+        return _insert(std::move(data));
+    }
+
+private:
+    template<typename DataType>
+    bool _insert(DataType&& data)
+    {
+        const std::string& tag = tag_of(data);
+        const std::size_t hash = _hash(tag);
+        if (_find_slot(tag, hash) != npos)
+            return false;
+        if (entries_.size() >= empty_slot_)
+            throw std::runtime_error("ConstraintStore: too many constraints!");
+        _grow_if_needed();
+        entries_.push_back(std::forward<DataType>(data));
+        hashes_.push_back(hash);
+        _insert_slot(static_cast<std::uint32_t>(entries_.size() - 1), hash);
+        ordered_is_valid_ = false;
+        return true;
+    }
+
+public:
+    /**
+     * @brief erase removes the constraint with a given tag. The last constraint takes its index.
+     * @return True if the constraint was removed. False if the tag is not stored.
+     */
+    bool erase(const std::string& tag)
+    {
+        const std::size_t slot = _find_slot(tag, _hash(tag));
+        if (slot == npos)
+            return false;
+        const std::uint32_t index = slots_[slot].index;
+        _erase_slot(slot);
+
+        const std::uint32_t last = static_cast<std::uint32_t>(entries_.size() - 1);
+        if (index != last)
+        {
+            // Point the slot of the last entry to its new index
+            const std::size_t last_slot = _find_slot(tag_of(entries_[last]), hashes_[last]);
+            slots_[last_slot].index = index;
+            entries_[index] = std::move(entries_[last]);
+            hashes_[index] = hashes_[last];
+        }
+        entries_.pop_back();
+        hashes_.pop_back();
+        ordered_is_valid_ = false;
+        return true;
+    }
+
+    /**
+     * @brief rename changes the tag of the constraint at a given index.
+     * @return True if the tag was changed. False if the new tag is used by another constraint.
+     */
+    bool rename(const std::size_t& index, const std::string& new_tag)
+    {
+        Data& data = entries_[index];
+        if (tag_of(data) == new_tag)
+            return true;
+        const std::size_t new_hash = _hash(new_tag);
+        if (_find_slot(new_tag, new_hash) != npos)
+            return false;
+        _erase_slot(_find_slot(tag_of(data), hashes_[index]));
+        std::visit([&](auto&& arg) {
+            arg.tag = new_tag;
+        }, data);
+        hashes_[index] = new_hash;
+        _insert_slot(static_cast<std::uint32_t>(index), new_hash);
+        ordered_is_valid_ = false;
+        return true;
+    }
+
+    /**
+     * @brief replace replaces several constraints at once. The tags of the replaced constraints can change,
+     *        including swaps between them (e.g. A->B and B->A). The caller must guarantee that the resulting
+     *        tags are unique.
+     * @param replacements Pairs of (index, new constraint). The constraints are moved into the store.
+     */
+    void replace(std::vector<std::pair<std::size_t, Data>>& replacements)
+    {
+        // Remove the slots of the renamed entries first, so that they never collide with the new tags
+        std::vector<bool> renamed(replacements.size(), false);
+        for (std::size_t i = 0; i < replacements.size(); ++i)
+        {
+            const std::size_t index = replacements[i].first;
+            if (tag_of(entries_[index]) != tag_of(replacements[i].second))
+            {
+                _erase_slot(_find_slot(tag_of(entries_[index]), hashes_[index]));
+                renamed[i] = true;
+            }
+        }
+        for (std::size_t i = 0; i < replacements.size(); ++i)
+        {
+            const std::size_t index = replacements[i].first;
+            entries_[index] = std::move(replacements[i].second);
+            if (renamed[i])
+            {
+                hashes_[index] = _hash(tag_of(entries_[index]));
+                _insert_slot(static_cast<std::uint32_t>(index), hashes_[index]);
+                ordered_is_valid_ = false;
+            }
+        }
+    }
+
+    /**
+     * @brief ordered returns the indexes of the constraints sorted by tag. The result is cached until
+     *        the next insert, erase or rename.
+     */
+    const std::pmr::vector<std::uint32_t>& ordered() const
+    {
+        if (!ordered_is_valid_)
+        {
+            ordered_.resize(entries_.size());
+            for (std::size_t i = 0; i < ordered_.size(); ++i)
+                ordered_[i] = static_cast<std::uint32_t>(i);
+            std::sort(ordered_.begin(), ordered_.end(), [this](const std::uint32_t& a, const std::uint32_t& b) {
+                return tag_of(entries_[a]) < tag_of(entries_[b]);
+            });
+            ordered_is_valid_ = true;
+        }
+        return ordered_;
+    }
+};
+
+}
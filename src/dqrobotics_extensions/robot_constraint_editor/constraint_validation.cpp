@@ -0,0 +1,285 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/constraint_validation.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace DQ_robotics_extensions
+{
+namespace ConstraintValidation
+{
+
+/**
+ * @brief The Columns struct points to the arrays checked by check_rows(). The "two" indexes of an
+ *        ENVIRONMENT_TO_ROBOT constraint are ConstraintColumns::no_index, and they are not checked.
+ */
+struct Columns{
+    const double* safe_distances;
+    const double* buffers;
+    const double* vfi_gains;
+    const std::int32_t* robot_indexes_one;
+    const std::int32_t* robot_indexes_two;
+    const std::int32_t* joint_indexes_one;
+    const std::int32_t* joint_indexes_two;
+};
+
+static constexpr std::uint8_t flag(const ISSUE& issue)
+{
+    return static_cast<std::uint8_t>(issue);
+}
+
+static bool is_invalid_index(const std::int32_t& index, const std::int32_t& min_index)
+{
+    return index < min_index && index != ConstraintColumns::no_index;
+}
+
+static std::uint8_t row_issues(const Columns& columns, const std::size_t& i, const std::int32_t& min_index)
+{
+    std::uint8_t issues = 0;
+    if (!(columns.safe_distances[i] >= 0.0))
+        issues |= flag(ISSUE::NEGATIVE_SAFE_DISTANCE);
+    if (!(columns.buffers[i] >= 0.0))
+        issues |= flag(ISSUE::NEGATIVE_BUFFER);
+    if (!std::isfinite(columns.vfi_gains[i]))
+        issues |= flag(ISSUE::NON_FINITE_VFI_GAIN);
+    if (columns.robot_indexes_one[i] < min_index || columns.joint_indexes_one[i] < min_index ||
+        is_invalid_index(columns.robot_indexes_two[i], min_index) ||
+        is_invalid_index(columns.joint_indexes_two[i], min_index))
+        issues |= flag(ISSUE::INVALID_INDEX);
+    return issues;
+}
+
+/**
+ * @brief check_rows checks the first size rows of the columns, and calls report(row, issues) for each
+ *        row that has issues. With SSE2, four rows are checked at a time, and the rows are looked at
+ *        one by one only if the group has an issue.
+ */
+template<typename Function>
+static void check_rows(const std::size_t& size, const Columns& columns, const std::int32_t& min_index,
+                       const Function& report)
+{
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d max = _mm_set1_pd(std::numeric_limits<double>::max());
+    const __m128d sign = _mm_set1_pd(-0.0);
+    const __m128i min = _mm_set1_epi32(min_index);
+    const __m128i no_index = _mm_set1_epi32(ConstraintColumns::no_index);
+
+    // The comparisons are negated (not greater or equal, not less or equal), so NaN is reported
+    auto negative = [&](const double* values) {
+        return _mm_movemask_pd(_mm_cmpnge_pd(_mm_loadu_pd(values), zero)) |
+               (_mm_movemask_pd(_mm_cmpnge_pd(_mm_loadu_pd(values + 2), zero)) << 2);
+    };
+    auto non_finite = [&](const double* values) {
+        return _mm_movemask_pd(_mm_cmpnle_pd(_mm_andnot_pd(sign, _mm_loadu_pd(values)), max)) |
+               (_mm_movemask_pd(_mm_cmpnle_pd(_mm_andnot_pd(sign, _mm_loadu_pd(values + 2)), max)) << 2);
+    };
+    auto load = [](const std::int32_t* values) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+    };
+    auto invalid_two = [&](const __m128i& values) {
+        return _mm_andnot_si128(_mm_cmpeq_epi32(values, no_index), _mm_cmplt_epi32(values, min));
+    };
+
+    for (; i + 4 <= size; i += 4)
+    {
+        const int negative_safe_distance = negative(columns.safe_distances + i);
+        const int negative_buffer = negative(columns.buffers + i);
+        const int non_finite_vfi_gain = non_finite(columns.vfi_gains + i);
+        const __m128i invalid = _mm_or_si128(
+            _mm_or_si128(_mm_cmplt_epi32(load(columns.robot_indexes_one + i), min),
+                         _mm_cmplt_epi32(load(columns.joint_indexes_one + i), min)),
+            _mm_or_si128(invalid_two(load(columns.robot_indexes_two + i)),
+                         invalid_two(load(columns.joint_indexes_two + i))));
+        const int invalid_index = _mm_movemask_ps(_mm_castsi128_ps(invalid));
+
+        if ((negative_safe_distance | negative_buffer | non_finite_vfi_gain | invalid_index) == 0)
+            continue;
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const std::uint8_t issues = static_cast<std::uint8_t>(
+                (((negative_safe_distance >> lane) & 1) ? flag(ISSUE::NEGATIVE_SAFE_DISTANCE) : 0) |
+                (((negative_buffer >> lane) & 1) ? flag(ISSUE::NEGATIVE_BUFFER) : 0) |
+                (((non_finite_vfi_gain >> lane) & 1) ? flag(ISSUE::NON_FINITE_VFI_GAIN) : 0) |
+                (((invalid_index >> lane) & 1) ? flag(ISSUE::INVALID_INDEX) : 0));
+            if (issues)
+                report(i + lane, issues);
+        }
+    }
+#endif
+    for (; i < size; ++i)
+    {
+        const std::uint8_t issues = row_issues(columns, i, min_index);
+        if (issues)
+            report(i, issues);
+    }
+}
+
+static const std::string& tag_of(const VFIConfigurationFile::Data& data)
+{
+    return std::visit([](auto&& arg) -> const std::string& {
+        return arg.tag;
+    }, data);
+}
+
+/**
+ * @brief validate_items copies the numbers of the constraints to arrays, in batches, and checks
+ *        each batch with check_rows().
+ */
+template<typename GetItem>
+static Report validate_items(const std::size_t& size, const GetItem& get_item, const bool& zero_indexed)
+{
+    constexpr std::size_t batch_size = 256;
+    double safe_distances[batch_size];
+    double buffers[batch_size];
+    double vfi_gains[batch_size];
+    std::int32_t robot_indexes_one[batch_size];
+    std::int32_t robot_indexes_two[batch_size];
+    std::int32_t joint_indexes_one[batch_size];
+    std::int32_t joint_indexes_two[batch_size];
+    const Columns columns{safe_distances, buffers, vfi_gains,
+                          robot_indexes_one, robot_indexes_two, joint_indexes_one, joint_indexes_two};
+
+    Report report;
+    report.number_of_constraints = size;
+    for (std::size_t first = 0; first < size; first += batch_size)
+    {
+        const std::size_t count = std::min(batch_size, size - first);
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            std::visit([&](auto&& arg) {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                    robot_indexes_one[j] = arg.robot_index;
+                    robot_indexes_two[j] = ConstraintColumns::no_index;
+                    joint_indexes_one[j] = arg.joint_index;
+                    joint_indexes_two[j] = ConstraintColumns::no_index;
+                } else {
+                    robot_indexes_one[j] = arg.robot_index_one;
+                    robot_indexes_two[j] = arg.robot_index_two;
+                    joint_indexes_one[j] = arg.joint_index_one;
+                    joint_indexes_two[j] = arg.joint_index_two;
+                }
+                safe_distances[j] = arg.safe_distance;
+                buffers[j] = arg.buffer;
+                vfi_gains[j] = arg.vfi_gain;
+            }, get_item(first + j));
+        }
+        check_rows(count, columns, zero_indexed ? 0 : 1, [&](const std::size_t& row, const std::uint8_t& issues) {
+            report.violations.push_back({tag_of(get_item(first + row)), issues});
+        });
+    }
+    return report;
+}
+
+/**
+ * @brief Report::to_string describes the violations, one constraint per line.
+ */
+std::string Report::to_string() const
+{
+    std::string text = std::to_string(violations.size()) + " of " + std::to_string(number_of_constraints) +
+                       " constraints failed the validation.\n";
+    for (const auto& violation : violations)
+        text.append("  '").append(violation.tag).append("': ").append(get_issue_names(violation.issues)).append("\n");
+    return text;
+}
+
+std::string get_issue_names(const std::uint8_t& issues)
+{
+    static const std::pair<ISSUE, const char*> names[] = {
+        {ISSUE::NEGATIVE_SAFE_DISTANCE, "NEGATIVE_SAFE_DISTANCE"},
+        {ISSUE::NEGATIVE_BUFFER, "NEGATIVE_BUFFER"},
+        {ISSUE::NON_FINITE_VFI_GAIN, "NON_FINITE_VFI_GAIN"},
+        {ISSUE::INVALID_INDEX, "INVALID_INDEX"}};
+    std::string text;
+    for (const auto& [issue, name] : names)
+    {
+        if (!(issues & flag(issue)))
+            continue;
+        if (!text.empty())
+            text.append(", ");
+        text.append(name);
+    }
+    return text;
+}
+
+/**
+ * @brief validate checks the numeric fields of a constraint set.
+ * @param data The constraints.
+ * @param zero_indexed True if the robot and joint indexes start at zero. False if they start at one.
+ * @return The report, with the violations in the order of data.
+ */
+Report validate(const std::vector<VFIConfigurationFile::Data>& data, const bool& zero_indexed)
+{
+    return validate_items(data.size(), [&](const std::size_t& i) -> const VFIConfigurationFile::Data& {
+        return data[i];
+    }, zero_indexed);
+}
+
+/**
+ * @brief validate checks the numeric fields of a constraint set given by an accessor, which avoids
+ *        copying the constraints.
+ * @param size The number of constraints.
+ * @param get_item Returns the constraint at a position, from 0 to size - 1.
+ * @param zero_indexed True if the robot and joint indexes start at zero. False if they start at one.
+ * @return The report, with the violations in the order of the positions.
+ */
+Report validate(const std::size_t& size,
+                const std::function<const VFIConfigurationFile::Data&(const std::size_t&)>& get_item,
+                const bool& zero_indexed)
+{
+    return validate_items(size, get_item, zero_indexed);
+}
+
+/**
+ * @brief validate checks the numeric fields of a columnar table, directly on its arrays.
+ * @param columns The table.
+ * @param zero_indexed True if the robot and joint indexes start at zero. False if they start at one.
+ * @return The report, with the violations in row order.
+ */
+Report validate(const ConstraintColumns& columns, const bool& zero_indexed)
+{
+    const Columns arrays{columns.get_safe_distances().data(), columns.get_buffers().data(),
+                         columns.get_vfi_gains().data(),
+                         columns.get_robot_indexes_one().data(), columns.get_robot_indexes_two().data(),
+                         columns.get_joint_indexes_one().data(), columns.get_joint_indexes_two().data()};
+    Report report;
+    report.number_of_constraints = columns.size();
+    const auto& tags = columns.get_tags();
+    check_rows(columns.size(), arrays, zero_indexed ? 0 : 1, [&](const std::size_t& row, const std::uint8_t& issues) {
+        report.violations.push_back({tags[row], issues});
+    });
+    return report;
+}
+
+}
+}
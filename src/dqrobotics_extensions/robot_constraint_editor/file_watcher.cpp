@@ -0,0 +1,139 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include "file_watcher.hpp"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief FileWatcher::FileWatcher ctor of the class. Starts watching the file, which does not need to exist.
+ * @param path The path of the file.
+ * @param debounce_interval The time without modifications before on_modified is called.
+ * @param on_modified The function called from the background thread.
+ */
+FileWatcher::FileWatcher(const std::string& path,
+                         const std::chrono::milliseconds& debounce_interval,
+                         const std::function<void()>& on_modified)
+    : name_(std::filesystem::path(path).filename().string()),
+      debounce_interval_(debounce_interval),
+      on_modified_(on_modified)
+{
+    const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    const std::string directory = parent.empty() ? std::string(".") : parent.string();
+    inotify_fd_ = ::inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+    if (inotify_fd_ < 0 || ::pipe2(stop_fds_, O_CLOEXEC | O_NONBLOCK) != 0 ||
+        ::inotify_add_watch(inotify_fd_, directory.c_str(),
+                            IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM) < 0)
+    {
+        const std::string error = std::strerror(errno);
+        _close();
+        throw std::runtime_error("FileWatcher: Fail to watch '" + path + "': " + error);
+    }
+    thread_ = std::thread([this]() {_run();});
+}
+
+FileWatcher::~FileWatcher()
+{
+    [[maybe_unused]] const ssize_t result = ::write(stop_fds_[1], "", 1);
+    if (thread_.joinable())
+        thread_.join();
+    _close();
+}
+
+void FileWatcher::_close()
+{
+    for (int* fd : {&inotify_fd_, &stop_fds_[0], &stop_fds_[1]})
+    {
+        if (*fd >= 0)
+            ::close(*fd);
+        *fd = -1;
+    }
+}
+
+/**
+ * @brief FileWatcher::_read_events reads the pending inotify events.
+ * @return True if any event concerns the watched file.
+ */
+bool FileWatcher::_read_events()
+{
+    alignas(inotify_event) char buffer[4096];
+    bool is_modified = false;
+    while (true)
+    {
+        const ssize_t size = ::read(inotify_fd_, buffer, sizeof(buffer));
+        if (size <= 0)
+            return is_modified;
+        for (ssize_t offset = 0; offset < size;)
+        {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            // After a queue overflow, the events of the file may have been lost
+            if ((event->mask & IN_Q_OVERFLOW) || (event->len > 0 && name_ == event->name))
+                is_modified = true;
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+}
+
+void FileWatcher::_run()
+{
+    pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {stop_fds_[0], POLLIN, 0}};
+    bool is_pending = false;
+    while (true)
+    {
+        // Every modification restarts the debounce interval
+        const int result = ::poll(fds, 2, is_pending ? static_cast<int>(debounce_interval_.count()) : -1);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result < 0)
+        {
+            std::cerr << "FileWatcher: " << std::strerror(errno) << std::endl;
+            return;
+        }
+        if (fds[1].revents)
+            return;
+        if (result == 0)
+        {
+            is_pending = false;
+            try {
+                on_modified_();
+            } catch (const std::exception& e) {
+                std::cerr << "FileWatcher: " << e.what() << std::endl;
+            }
+            continue;
+        }
+        if (_read_events())
+            is_pending = true;
+    }
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The FileWatcher class calls a function from a background thread when a file is modified, using
+ *        inotify. The directory of the file is watched, so that the file can also be replaced by a rename
+ *        (as most editors save). The modifications are debounced: the function is called once the file has
+ *        not been modified for the debounce interval. The exceptions of the function are printed to std::cerr.
+ *        The function must not destroy the watcher.
+ *        This class is internal to the library.
+ */
+class FileWatcher
+{
+    const std::string name_;  // The name of the file in its directory
+    const std::chrono::milliseconds debounce_interval_;
+    const std::function<void()> on_modified_;
+
+    int inotify_fd_ = -1;
+    int stop_fds_[2] = {-1, -1};  // Pipe that wakes the background thread up to stop
+    std::thread thread_;
+
+    void _run();
+    bool _read_events();
+    void _close();
+
+public:
+    FileWatcher(const std::string& path,
+                const std::chrono::milliseconds& debounce_interval,
+                const std::function<void()>& on_modified);
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+};
+
+}
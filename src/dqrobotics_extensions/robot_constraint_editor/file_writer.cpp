@@ -0,0 +1,312 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/file_writer.hpp>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <set>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace DQ_robotics_extensions
+{
+
+class FileWriter::Impl
+{
+public:
+    SAVE_MODE save_mode_;
+    SYNC_POLICY sync_policy_;
+
+    int fd_ = -1;
+    std::string path_;      // The target file
+    std::string temp_path_; // The file being written. Equal to path_ in the IN_PLACE and APPEND modes.
+    off_t append_offset_ = 0;  // The size of the file before open() in the APPEND mode
+    bool created_ = false;     // True if open() created the file in the APPEND mode
+
+    // Files saved with SYNC_POLICY::DEFERRED_SYNC that were not synced yet.
+    std::set<std::string> pending_files_;
+    std::set<std::string> pending_directories_;
+
+    Impl(const SAVE_MODE& save_mode, const SYNC_POLICY& sync_policy)
+        : save_mode_(save_mode), sync_policy_(sync_policy)
+    {
+
+    };
+
+    ~Impl()
+    {
+        _discard();
+    }
+
+    static std::runtime_error _error(const std::string& message, const std::string& path)
+    {
+        return std::runtime_error(message + path + " (" + std::strerror(errno) + ")");
+    }
+
+    static std::string _directory_of(const std::string& path)
+    {
+        std::string directory = std::filesystem::path(path).parent_path().string();
+        return directory.empty() ? std::string(".") : directory;
+    }
+
+    /**
+     * @brief _sync_path opens a file or a directory and flushes it to the storage device.
+     * @param path The path of the file or directory.
+     */
+    static void _sync_path(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw _error("Cannot open for syncing: ", path);
+        int result = ::fsync(fd);
+        ::close(fd);
+        if (result != 0)
+            throw _error("Failed to sync: ", path);
+    }
+
+    /**
+     * @brief _open_temporary_file creates a new file next to the target file. The name is unique
+     *        within the process and across processes, and the file is created with O_EXCL so that
+     *        an existing file is never reused.
+     */
+    void _open_temporary_file()
+    {
+        static std::atomic<unsigned long> counter{0};
+        const std::filesystem::path target(path_);
+        std::string prefix(".");
+        prefix.append(target.filename().string()).append(".tmp.").append(std::to_string(::getpid())).append(".");
+        for (int attempt = 0; attempt < 100; ++attempt)
+        {
+            temp_path_ = (target.parent_path() / (prefix + std::to_string(counter++))).string();
+            fd_ = ::open(temp_path_.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+            if (fd_ >= 0 || errno != EEXIST)
+                break;
+        }
+        if (fd_ < 0)
+            throw _error("Cannot open file for writing: ", temp_path_);
+
+        // Keep the permissions of the file that is replaced
+        struct stat target_stat;
+        if (::stat(path_.c_str(), &target_stat) == 0)
+            ::fchmod(fd_, target_stat.st_mode & 07777);
+    }
+
+    void _discard()
+    {
+        if (fd_ < 0)
+            return;
+        if (save_mode_ == SAVE_MODE::APPEND)
+        {
+            // Best effort, since _discard() is also called by the destructor
+            [[maybe_unused]] const int result = ::ftruncate(fd_, append_offset_);
+        }
+        ::close(fd_);
+        fd_ = -1;
+        if (save_mode_ == SAVE_MODE::ATOMIC)
+            ::unlink(temp_path_.c_str());
+    }
+
+    void _open_for_append()
+    {
+        temp_path_ = path_;
+        struct stat target_stat;
+        created_ = ::stat(path_.c_str(), &target_stat) != 0;
+        fd_ = ::open(path_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+        if (fd_ < 0)
+            throw _error("Cannot open file for appending: ", path_);
+        if (::fstat(fd_, &target_stat) != 0)
+        {
+            auto error = _error("Cannot read the size of: ", path_);
+            ::close(fd_);
+            fd_ = -1;
+            throw error;
+        }
+        append_offset_ = target_stat.st_size;
+    }
+};
+
+/**
+ * @brief FileWriter::FileWriter ctor of the class.
+ * @param save_mode SAVE_MODE::IN_PLACE, SAVE_MODE::ATOMIC or SAVE_MODE::APPEND.
+ * @param sync_policy SYNC_POLICY::NO_SYNC, SYNC_POLICY::SYNC_EACH_FILE or SYNC_POLICY::DEFERRED_SYNC.
+ */
+FileWriter::FileWriter(const SAVE_MODE& save_mode, const SYNC_POLICY& sync_policy)
+{
+    impl_ = std::make_shared<FileWriter::Impl>(save_mode, sync_policy);
+}
+
+void FileWriter::set_save_mode(const SAVE_MODE& save_mode)
+{
+    if (impl_->fd_ >= 0)
+        throw std::runtime_error("FileWriter::set_save_mode: A file is being written!");
+    impl_->save_mode_ = save_mode;
+}
+
+FileWriter::SAVE_MODE FileWriter::get_save_mode() const
+{
+    return impl_->save_mode_;
+}
+
+void FileWriter::set_sync_policy(const SYNC_POLICY& sync_policy)
+{
+    impl_->sync_policy_ = sync_policy;
+}
+
+FileWriter::SYNC_POLICY FileWriter::get_sync_policy() const
+{
+    return impl_->sync_policy_;
+}
+
+/**
+ * @brief FileWriter::open starts writing a file. In the ATOMIC mode the target file is not modified
+ *                         until commit() is called. In the APPEND mode the data is written at its end.
+ * @param path The name of the file including its path and format.
+ */
+void FileWriter::open(const std::string& path)
+{
+    if (impl_->fd_ >= 0)
+        throw std::runtime_error("FileWriter::open: A file is being written!");
+    impl_->path_ = path;
+    if (impl_->save_mode_ == SAVE_MODE::ATOMIC)
+    {
+        impl_->_open_temporary_file();
+    }
+    else if (impl_->save_mode_ == SAVE_MODE::APPEND)
+    {
+        impl_->_open_for_append();
+    }
+    else
+    {
+        impl_->temp_path_ = path;
+        impl_->fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+        if (impl_->fd_ < 0)
+            throw Impl::_error("Cannot open file for writing: ", path);
+    }
+}
+
+/**
+ * @brief FileWriter::write writes a block of data to the file opened by open().
+ * @param data The data to write.
+ * @param size The number of bytes to write.
+ */
+void FileWriter::write(const char* data, const std::size_t& size)
+{
+    if (impl_->fd_ < 0)
+        throw std::runtime_error("FileWriter::write: No file is open!");
+    std::size_t written = 0;
+    while (written < size)
+    {
+        ssize_t result = ::write(impl_->fd_, data + written, size - written);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw Impl::_error("Failed to write the file: ", impl_->temp_path_);
+        }
+        written += static_cast<std::size_t>(result);
+    }
+}
+
+/**
+ * @brief FileWriter::commit closes the file. In the ATOMIC mode, the temporary file replaces the target file.
+ *        The file is synced according to the sync policy.
+ */
+void FileWriter::commit()
+{
+    if (impl_->fd_ < 0)
+        throw std::runtime_error("FileWriter::commit: No file is open!");
+
+    if (impl_->sync_policy_ == SYNC_POLICY::SYNC_EACH_FILE && ::fsync(impl_->fd_) != 0)
+    {
+        auto error = Impl::_error("Failed to sync: ", impl_->temp_path_);
+        impl_->_discard();
+        throw error;
+    }
+    int fd = impl_->fd_;
+    impl_->fd_ = -1;
+    if (::close(fd) != 0)
+    {
+        auto error = Impl::_error("Failed to close: ", impl_->temp_path_);
+        if (impl_->save_mode_ == SAVE_MODE::ATOMIC)
+            ::unlink(impl_->temp_path_.c_str());
+        throw error;
+    }
+
+    if (impl_->save_mode_ == SAVE_MODE::ATOMIC &&
+        std::rename(impl_->temp_path_.c_str(), impl_->path_.c_str()) != 0)
+    {
+        auto error = Impl::_error("Failed to replace the file: ", impl_->path_);
+        ::unlink(impl_->temp_path_.c_str());
+        throw error;
+    }
+
+    const std::string directory = Impl::_directory_of(impl_->path_);
+    switch (impl_->sync_policy_) {
+    case SYNC_POLICY::NO_SYNC:
+        break;
+    case SYNC_POLICY::SYNC_EACH_FILE:
+        // The rename (or the creation of an appended file) is only durable after the directory is synced
+        if (impl_->save_mode_ == SAVE_MODE::ATOMIC ||
+            (impl_->save_mode_ == SAVE_MODE::APPEND && impl_->created_))
+            Impl::_sync_path(directory);
+        break;
+    case SYNC_POLICY::DEFERRED_SYNC:
+        impl_->pending_files_.insert(impl_->path_);
+        impl_->pending_directories_.insert(directory);
+        break;
+    }
+}
+
+/**
+ * @brief FileWriter::discard closes the file without committing it. In the ATOMIC mode the temporary
+ *                            file is removed and the target file is left untouched. In the APPEND mode
+ *                            the file is truncated back to its size before open().
+ */
+void FileWriter::discard()
+{
+    impl_->_discard();
+}
+
+/**
+ * @brief FileWriter::sync_pending flushes the files committed with SYNC_POLICY::DEFERRED_SYNC, and then
+ *        each of their directories once.
+ */
+void FileWriter::sync_pending()
+{
+    // The entries are removed once synced, so a failure leaves the remaining ones pending
+    for (auto* pending : {&impl_->pending_files_, &impl_->pending_directories_})
+    {
+        while (!pending->empty())
+        {
+            Impl::_sync_path(*pending->begin());
+            pending->erase(pending->begin());
+        }
+    }
+}
+
+}
@@ -0,0 +1,306 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/interned_constraint_set.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace DQ_robotics_extensions
+{
+
+class InternedConstraintSet::Impl
+{
+public:
+    /**
+     * @brief The Record struct stores the fields of a constraint, except for the tag. The fields of an
+     *        ENVIRONMENT_TO_ROBOT constraint use the "one" (environment) and "two" (robot) slots.
+     */
+    struct Record{
+        double safe_distance;
+        double buffer;
+        double vfi_gain;
+        SymbolTable::Id vfi_type;
+        SymbolTable::Id direction;
+        SymbolTable::Id primitive_type_one;
+        SymbolTable::Id primitive_type_two;
+        std::uint32_t entities_one_offset;
+        std::uint32_t entities_one_count;
+        std::uint32_t entities_two_offset;
+        std::uint32_t entities_two_count;
+        std::int32_t robot_index_one;
+        std::int32_t robot_index_two;
+        std::int32_t joint_index_one;
+        std::int32_t joint_index_two;
+        bool is_environment_to_robot;
+    };
+
+    std::shared_ptr<SymbolTable> symbols_;
+    std::vector<Record> records_;
+    std::vector<SymbolTable::Id> entity_ids_;
+    std::vector<std::string> tags_;
+
+    Impl(const std::shared_ptr<SymbolTable>& symbols)
+        : symbols_(symbols)
+    {
+
+    };
+
+    void _intern_list(const std::vector<std::string>& list, std::uint32_t& offset, std::uint32_t& count)
+    {
+        if (entity_ids_.size() + list.size() > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("InternedConstraintSet: Too many entities!");
+        offset = static_cast<std::uint32_t>(entity_ids_.size());
+        count = static_cast<std::uint32_t>(list.size());
+        for (const auto& entity : list)
+            entity_ids_.push_back(symbols_->intern(entity));
+    }
+
+    void _get_list(const std::uint32_t& offset, const std::uint32_t& count, std::vector<std::string>& list) const
+    {
+        list.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i)
+            list[i] = symbols_->get(entity_ids_[offset + i]);
+    }
+
+    const Record& _record(const std::size_t& index) const
+    {
+        if (index >= records_.size())
+            throw std::runtime_error("InternedConstraintSet: Index " + std::to_string(index) + " out of range!");
+        return records_[index];
+    }
+};
+
+/**
+ * @brief InternedConstraintSet::InternedConstraintSet ctor of the class. The set uses its own SymbolTable.
+ */
+InternedConstraintSet::InternedConstraintSet()
+    : InternedConstraintSet(std::make_shared<SymbolTable>())
+{
+
+}
+
+/**
+ * @brief InternedConstraintSet::InternedConstraintSet ctor of the class.
+ * @param symbols The SymbolTable used to intern the strings. It can be shared with other sets.
+ */
+InternedConstraintSet::InternedConstraintSet(const std::shared_ptr<SymbolTable>& symbols)
+{
+    if (!symbols)
+        throw std::runtime_error("The SymbolTable pointer is undefined!");
+    impl_ = std::make_shared<InternedConstraintSet::Impl>(symbols);
+}
+
+/**
+ * @brief InternedConstraintSet::reserve reserves memory for a number of constraints.
+ * @param size The expected number of constraints.
+ */
+void InternedConstraintSet::reserve(const std::size_t& size)
+{
+    impl_->records_.reserve(size);
+    impl_->tags_.reserve(size);
+}
+
+/**
+ * @brief InternedConstraintSet::clear removes all the constraints. The strings stay in the SymbolTable.
+ */
+void InternedConstraintSet::clear()
+{
+    impl_->records_.clear();
+    impl_->entity_ids_.clear();
+    impl_->tags_.clear();
+}
+
+/**
+ * @brief InternedConstraintSet::add_data adds a constraint at the end of the set.
+ * @param data The constraint.
+ */
+void InternedConstraintSet::add_data(const VFIConfigurationFile::Data& data)
+{
+    Impl::Record record{};
+    std::visit([&](auto&& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        record.safe_distance = arg.safe_distance;
+        record.buffer = arg.buffer;
+        record.vfi_gain = arg.vfi_gain;
+        record.vfi_type = impl_->symbols_->intern(arg.vfi_type);
+        record.direction = impl_->symbols_->intern(arg.direction);
+
+        if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+            record.is_environment_to_robot = true;
+            record.primitive_type_one = impl_->symbols_->intern(arg.entity_environment_primitive_type);
+            record.primitive_type_two = impl_->symbols_->intern(arg.entity_robot_primitive_type);
+            impl_->_intern_list(arg.cs_entity_environment, record.entities_one_offset, record.entities_one_count);
+            impl_->_intern_list(arg.cs_entity_robot, record.entities_two_offset, record.entities_two_count);
+            record.robot_index_one = arg.robot_index;
+            record.joint_index_one = arg.joint_index;
+        } else if constexpr (std::is_same_v<T, VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>) {
+            record.is_environment_to_robot = false;
+            record.primitive_type_one = impl_->symbols_->intern(arg.entity_one_primitive_type);
+            record.primitive_type_two = impl_->symbols_->intern(arg.entity_two_primitive_type);
+            impl_->_intern_list(arg.cs_entity_one, record.entities_one_offset, record.entities_one_count);
+            impl_->_intern_list(arg.cs_entity_two, record.entities_two_offset, record.entities_two_count);
+            record.robot_index_one = arg.robot_index_one;
+            record.robot_index_two = arg.robot_index_two;
+            record.joint_index_one = arg.joint_index_one;
+            record.joint_index_two = arg.joint_index_two;
+        }
+        impl_->tags_.push_back(arg.tag);
+    }, data);
+    impl_->records_.push_back(record);
+}
+
+/**
+ * @brief InternedConstraintSet::add_data adds several constraints at the end of the set.
+ * @param vector_data The constraints.
+ */
+void InternedConstraintSet::add_data(const std::vector<VFIConfigurationFile::Data>& vector_data)
+{
+    reserve(size() + vector_data.size());
+    for (const auto& data : vector_data)
+        add_data(data);
+}
+
+/**
+ * @brief InternedConstraintSet::size returns the number of constraints.
+ */
+std::size_t InternedConstraintSet::size() const
+{
+    return impl_->records_.size();
+}
+
+/**
+ * @brief InternedConstraintSet::empty checks if the set has no constraints.
+ */
+bool InternedConstraintSet::empty() const
+{
+    return impl_->records_.empty();
+}
+
+/**
+ * @brief InternedConstraintSet::get_tag gets the tag of a constraint.
+ * @param index The index of the constraint.
+ * @return The desired tag.
+ */
+const std::string& InternedConstraintSet::get_tag(const std::size_t& index) const
+{
+    impl_->_record(index);
+    return impl_->tags_[index];
+}
+
+/**
+ * @brief InternedConstraintSet::get_data gets a constraint.
+ * @param index The index of the constraint.
+ * @return The desired constraint.
+ */
+VFIConfigurationFile::Data InternedConstraintSet::get_data(const std::size_t& index) const
+{
+    VFIConfigurationFile::Data data;
+    get_data(index, data);
+    return data;
+}
+
+/**
+ * @brief InternedConstraintSet::get_data gets a constraint into an existing object. When the object
+ *        already holds a constraint of the same type, the memory of its strings and lists is reused,
+ *        which makes this overload suitable for loops over the whole set.
+ * @param index The index of the constraint.
+ * @param data The object that receives the constraint.
+ */
+void InternedConstraintSet::get_data(const std::size_t& index, VFIConfigurationFile::Data& data) const
+{
+    const Impl::Record& record = impl_->_record(index);
+    if (record.is_environment_to_robot) {
+        if (!std::holds_alternative<VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(data))
+            data = VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA();
+    } else {
+        if (!std::holds_alternative<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>(data))
+            data = VFIConfigurationFile::ROBOT_TO_ROBOT_DATA();
+    }
+
+    std::visit([&](auto&& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        arg.safe_distance = record.safe_distance;
+        arg.buffer = record.buffer;
+        arg.vfi_gain = record.vfi_gain;
+        arg.vfi_type = impl_->symbols_->get(record.vfi_type);
+        arg.direction = impl_->symbols_->get(record.direction);
+        arg.tag = impl_->tags_[index];
+
+        if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+            arg.entity_environment_primitive_type = impl_->symbols_->get(record.primitive_type_one);
+            arg.entity_robot_primitive_type = impl_->symbols_->get(record.primitive_type_two);
+            impl_->_get_list(record.entities_one_offset, record.entities_one_count, arg.cs_entity_environment);
+            impl_->_get_list(record.entities_two_offset, record.entities_two_count, arg.cs_entity_robot);
+            arg.robot_index = record.robot_index_one;
+            arg.joint_index = record.joint_index_one;
+        } else if constexpr (std::is_same_v<T, VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>) {
+            arg.entity_one_primitive_type = impl_->symbols_->get(record.primitive_type_one);
+            arg.entity_two_primitive_type = impl_->symbols_->get(record.primitive_type_two);
+            impl_->_get_list(record.entities_one_offset, record.entities_one_count, arg.cs_entity_one);
+            impl_->_get_list(record.entities_two_offset, record.entities_two_count, arg.cs_entity_two);
+            arg.robot_index_one = record.robot_index_one;
+            arg.robot_index_two = record.robot_index_two;
+            arg.joint_index_one = record.joint_index_one;
+            arg.joint_index_two = record.joint_index_two;
+        }
+    }, data);
+}
+
+/**
+ * @brief InternedConstraintSet::get_data gets all the constraints, in insertion order.
+ * @return The desired data vector.
+ */
+std::vector<VFIConfigurationFile::Data> InternedConstraintSet::get_data() const
+{
+    std::vector<VFIConfigurationFile::Data> vector_data(size());
+    for (std::size_t i = 0; i < vector_data.size(); ++i)
+        get_data(i, vector_data[i]);
+    return vector_data;
+}
+
+/**
+ * @brief InternedConstraintSet::get_symbols gets the SymbolTable used by the set.
+ */
+std::shared_ptr<SymbolTable> InternedConstraintSet::get_symbols() const
+{
+    return impl_->symbols_;
+}
+
+/**
+ * @brief InternedConstraintSet::memory_usage estimates the heap memory used by the set, in bytes,
+ *        including its SymbolTable.
+ */
+std::size_t InternedConstraintSet::memory_usage() const
+{
+    std::size_t bytes = impl_->records_.capacity()*sizeof(Impl::Record) +
+                        impl_->entity_ids_.capacity()*sizeof(SymbolTable::Id) +
+                        impl_->tags_.capacity()*sizeof(std::string) +
+                        impl_->symbols_->memory_usage();
+    for (const auto& tag : impl_->tags_)
+        if (tag.capacity() > std::string().capacity())
+            bytes += tag.capacity() + 1;
+    return bytes;
+}
+
+}
@@ -0,0 +1,190 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include "journal_writer.hpp"
+#include <utility>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief JournalWriter::JournalWriter ctor of the class. Starts the background thread.
+ * @param path The path of the journal.
+ * @param fingerprint The fingerprint of the base file of the journal.
+ * @param number_of_existing_entries The valid entries already in the journal. If zero, the journal is
+ *        replaced by a new one at the first commit.
+ * @param commit_interval The time the entries are buffered before they are written.
+ * @param sync_policy When the journal is flushed to the storage device.
+ */
+JournalWriter::JournalWriter(const std::string& path,
+                             const ConstraintJournal::Fingerprint& fingerprint,
+                             const std::size_t& number_of_existing_entries,
+                             const std::chrono::microseconds& commit_interval,
+                             const FileWriter::SYNC_POLICY& sync_policy)
+    : path_(path),
+      fingerprint_(fingerprint),
+      commit_interval_(commit_interval),
+      sync_policy_(sync_policy),
+      number_of_entries_(number_of_existing_entries),
+      number_of_committed_entries_(number_of_existing_entries),
+      has_header_(number_of_existing_entries > 0)
+{
+    thread_ = std::thread([this]() {_run();});
+}
+
+JournalWriter::~JournalWriter()
+{
+    try {
+        stop();
+    } catch (...) {
+        // The destructor must not throw. Use stop() to get the error.
+    }
+}
+
+void JournalWriter::_run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        pending_condition_.wait(lock, [this]() {
+            return !pending_.empty() || is_stop_requested_;
+        });
+        if (pending_.empty() && is_stop_requested_)
+            return;
+        // Group commit: let more entries arrive, unless someone waits for them
+        if (!is_flush_requested_ && !is_stop_requested_)
+            pending_condition_.wait_for(lock, commit_interval_, [this]() {
+                return is_flush_requested_ || is_stop_requested_;
+            });
+
+        std::string entries;
+        entries.swap(pending_);
+        const std::uint64_t number_of_entries = number_of_entries_;
+        const bool append = has_header_;
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            ConstraintJournal::write(path_, fingerprint_, entries, append, sync_policy_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error)
+        {
+            // The entries are lost, so the journal no longer matches the data
+            error_ = error;
+            is_stop_requested_ = true;
+            pending_.clear();
+            committed_condition_.notify_all();
+            return;
+        }
+        has_header_ = true;
+        number_of_committed_entries_ = number_of_entries;
+        if (pending_.empty())
+            is_flush_requested_ = false;
+        committed_condition_.notify_all();
+    }
+}
+
+void JournalWriter::_check_error()
+{
+    if (error_)
+        std::rethrow_exception(error_);
+}
+
+/**
+ * @brief JournalWriter::_append buffers an entry encoded by a function, and wakes the background thread up
+ *        if it is the first buffered entry.
+ */
+template<typename Encode>
+std::uint64_t JournalWriter::_append(const Encode& encode)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    _check_error();
+    const bool was_empty = pending_.empty();
+    encode(pending_);
+    const std::uint64_t number_of_entries = ++number_of_entries_;
+    lock.unlock();
+    if (was_empty)
+        pending_condition_.notify_one();
+    return number_of_entries;
+}
+
+/**
+ * @brief JournalWriter::append_upsert buffers an entry that adds or replaces a constraint.
+ * @return The number of entries of the journal, including the buffered ones.
+ */
+std::uint64_t JournalWriter::append_upsert(const ConstraintJournal::Data& data)
+{
+    return _append([&](std::string& entries) {
+        ConstraintJournal::append_upsert(entries, data);
+    });
+}
+
+/**
+ * @brief JournalWriter::append_remove buffers an entry that removes the constraint with a tag.
+ * @return The number of entries of the journal, including the buffered ones.
+ */
+std::uint64_t JournalWriter::append_remove(const std::string& tag)
+{
+    return _append([&](std::string& entries) {
+        ConstraintJournal::append_remove(entries, tag);
+    });
+}
+
+/**
+ * @brief JournalWriter::flush writes the buffered entries without waiting for the commit interval, and
+ *        waits until they are written.
+ */
+void JournalWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    _check_error();
+    if (number_of_committed_entries_ == number_of_entries_)
+        return;
+    is_flush_requested_ = true;
+    pending_condition_.notify_one();
+    const std::uint64_t target = number_of_entries_;
+    committed_condition_.wait(lock, [&]() {
+        return number_of_committed_entries_ >= target || error_;
+    });
+    _check_error();
+}
+
+/**
+ * @brief JournalWriter::stop writes the buffered entries and stops the background thread.
+ */
+void JournalWriter::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stop_requested_ = true;
+    }
+    pending_condition_.notify_one();
+    if (thread_.joinable())
+        thread_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    _check_error();
+}
+
+}
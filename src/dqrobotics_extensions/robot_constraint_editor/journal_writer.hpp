@@ -0,0 +1,86 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "constraint_journal.hpp"
+
+namespace DQ_robotics_extensions
+{
+/**
+ * @brief The JournalWriter class appends entries to a ConstraintJournal from a background thread.
+ *        The entries are encoded by the caller's thread and buffered. The background thread waits for
+ *        the commit interval after the first buffered entry, so that the entries of that interval are
+ *        written and synced together (group commit). An error of the background thread is rethrown by
+ *        the next call to append_*(), flush() or stop().
+ *        This class is internal to the library.
+ */
+class JournalWriter
+{
+    const std::string path_;
+    const ConstraintJournal::Fingerprint fingerprint_;
+    const std::chrono::microseconds commit_interval_;
+    const FileWriter::SYNC_POLICY sync_policy_;
+
+    std::mutex mutex_;
+    std::condition_variable pending_condition_;    // Signals the background thread
+    std::condition_variable committed_condition_;  // Signals flush()
+    std::string pending_;                          // Encoded entries that were not written yet
+    std::uint64_t number_of_entries_ = 0;          // Entries of the journal, including the pending ones
+    std::uint64_t number_of_committed_entries_ = 0;
+    bool has_header_;
+    bool is_flush_requested_ = false;
+    bool is_stop_requested_ = false;
+    std::exception_ptr error_;
+    std::thread thread_;
+
+    void _run();
+    void _check_error();
+    template<typename Encode>
+    std::uint64_t _append(const Encode& encode);
+
+public:
+    JournalWriter(const std::string& path,
+                  const ConstraintJournal::Fingerprint& fingerprint,
+                  const std::size_t& number_of_existing_entries,
+                  const std::chrono::microseconds& commit_interval,
+                  const FileWriter::SYNC_POLICY& sync_policy);
+    ~JournalWriter();
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    std::uint64_t append_upsert(const ConstraintJournal::Data& data);
+    std::uint64_t append_remove(const std::string& tag);
+    void flush();
+    void stop();
+
+    const std::string& get_path() const {return path_;}
+};
+
+}
@@ -0,0 +1,107 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    RobotConstraintEditor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    RobotConstraintEditor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with RobotConstraintEditor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace DQ_robotics_extensions
+{
+
+/**
+ * @brief resolve_number_of_threads returns the number of threads to use for a given amount of work.
+ * @param number_of_threads The requested number of threads. Zero means one thread per core.
+ * @param count The number of work items.
+ * @return A number between 1 and max(count, 1).
+ */
+inline std::size_t resolve_number_of_threads(const std::size_t& number_of_threads, const std::size_t& count)
+{
+    std::size_t threads = number_of_threads;
+    if (threads == 0)
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return std::max<std::size_t>(std::min(threads, count), 1);
+}
+
+/**
+ * @brief parallel_for calls function(i) for each i in [0, count) on a pool of worker threads. The workers
+ *        take the indexes in increasing order. If some calls throw, the exception of the lowest failing
+ *        index is rethrown after all the workers finish, so the error does not depend on the scheduling.
+ *        The indexes after a known failure are skipped. This function is internal to the library.
+ * @param count The number of work items.
+ * @param number_of_threads The number of threads. Zero means one thread per core.
+ * @param function The work to do for each index. Calls with different indexes run concurrently.
+ */
+template<typename Function>
+void parallel_for(const std::size_t& count, const std::size_t& number_of_threads, const Function& function)
+{
+    constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> next_index{0};
+    std::atomic<std::size_t> failed_index{npos};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+
+    auto worker = [&]() {
+        for (std::size_t i = next_index++; i < count; i = next_index++)
+        {
+            if (i > failed_index.load())
+                continue;
+            try {
+                function(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failure_mutex);
+                if (i < failed_index.load())
+                {
+                    failed_index = i;
+                    failure = std::current_exception();
+                }
+            }
+        }
+    };
+
+    const std::size_t threads = resolve_number_of_threads(number_of_threads, count);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        try {
+            workers.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break; // Continue with the threads that could be created
+        }
+    }
+    worker(); // The calling thread is also a worker
+    for (auto& thread : workers)
+        thread.join();
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+}
@@ -0,0 +1,328 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/parse_cache.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_binary_format.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include "constraint_journal.hpp"
+
+namespace DQ_robotics_extensions
+{
+
+namespace
+{
+// Increase it when the data parsed from a file may change (e.g. a new field), so that the old entries are not used
+constexpr std::uint32_t KEY_VERSION = 1;
+// The temporary files older than this were left by a process that crashed while writing an entry
+constexpr std::chrono::hours TEMPORARY_FILE_LIFETIME(1);
+
+std::uint64_t _digest(const std::string& content)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const char& c : content)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string _hex(const std::uint64_t& value)
+{
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string text(16, '0');
+    for (std::size_t i = 0; i < 16; ++i)
+        text[15 - i] = digits[(value >> (4*i)) & 0xf];
+    return text;
+}
+
+bool _is_temporary_file(const std::string& name)
+{
+    return !name.empty() && name[0] == '.' && name.find(".tmp.") != std::string::npos;
+}
+}
+
+class ParseCache::Impl
+{
+public:
+    std::filesystem::path directory_;
+    std::uint64_t max_size_;
+    std::size_t max_number_of_entries_;
+    std::atomic<std::size_t> number_of_hits_{0};
+    std::atomic<std::size_t> number_of_misses_{0};
+
+    /**
+     * @brief _suffix returns the end of the names of the entries of this version of the library.
+     */
+    static std::string _suffix()
+    {
+        return std::string(".k").append(std::to_string(KEY_VERSION)).append("f")
+            .append(std::to_string(VFIBinaryFormat::FORMAT_VERSION)).append(".vfib");
+    }
+
+    /**
+     * @brief _entry_path returns the path of the entry of a file content. The key is the 64-bit FNV-1a
+     *        digest of the content plus its size.
+     */
+    std::filesystem::path _entry_path(const std::string& content) const
+    {
+        return directory_ / _hex(_digest(content)).append("-").append(_hex(content.size())).append(_suffix());
+    }
+
+    static bool _read_file(const std::string& file, std::string& content)
+    {
+        std::ifstream stream(file, std::ios::binary | std::ios::ate);
+        if (!stream)
+            return false;
+        content.resize(static_cast<std::size_t>(stream.tellg()));
+        stream.seekg(0);
+        return static_cast<bool>(stream.read(content.data(), static_cast<std::streamsize>(content.size())));
+    }
+
+    /**
+     * @brief _read_entry reads an entry, and removes it if it is invalid.
+     * @return True if the entry was read. False if it does not exist or is invalid.
+     */
+    static bool _read_entry(const std::filesystem::path& path,
+                            std::vector<VFIConfigurationFile::Data>& data,
+                            int& vfi_file_version,
+                            bool& zero_indexed)
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(path, error))
+            return false;
+        try {
+            VFIConfigurationFileBinary binary;
+            binary.load_data(path.string());
+            data = binary.take_data();
+            vfi_file_version = binary.get_vfi_file_version();
+            zero_indexed = binary.is_zero_indexed();
+        } catch (const std::exception&) {
+            // Entries are renamed into place once complete, so this one is damaged (or was removed meanwhile)
+            std::filesystem::remove(path, error);
+            return false;
+        }
+        // Keeps the recently used entries (see _evict())
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+        return true;
+    }
+
+    /**
+     * @brief _write_entry writes an entry, unless it exceeds the size limit by itself.
+     * @return True if the entry was kept.
+     */
+    bool _write_entry(const std::filesystem::path& path,
+                      const std::vector<VFIConfigurationFile::Data>& data,
+                      const int& vfi_file_version,
+                      const bool& zero_indexed) const
+    {
+        std::filesystem::create_directories(directory_);
+        // Readers of other processes see either the whole entry or no entry. A lost entry is parsed again,
+        // so it does not need to be synced.
+        VFIConfigurationFileBinary binary;
+        binary.set_save_mode(FileWriter::SAVE_MODE::ATOMIC);
+        binary.set_sync_policy(FileWriter::SYNC_POLICY::NO_SYNC);
+        binary.save_data(data, vfi_file_version, zero_indexed, path.string());
+        if (std::filesystem::file_size(path) <= max_size_)
+            return true;
+        std::filesystem::remove(path);
+        return false;
+    }
+
+    /**
+     * @brief _evict removes the entries of other versions of the library, the stale temporary files and,
+     *        while the cache exceeds its limits, the least recently used entries. Other processes may remove
+     *        the same files, so the errors are ignored.
+     */
+    void _evict() const
+    {
+        struct Entry{
+            std::filesystem::path path;
+            std::uint64_t size;
+            std::filesystem::file_time_type time;
+            bool is_current;
+        };
+        const std::string suffix = _suffix();
+        const auto now = std::filesystem::file_time_type::clock::now();
+        std::vector<Entry> entries;
+        std::error_code error;
+        for (std::filesystem::directory_iterator it(directory_, error), end; !error && it != end; it.increment(error))
+        {
+            const std::string name = it->path().filename().string();
+            std::error_code entry_error;
+            const auto time = std::filesystem::last_write_time(it->path(), entry_error);
+            if (entry_error)
+                continue;
+            if (_is_temporary_file(name))
+            {
+                if (now - time > TEMPORARY_FILE_LIFETIME)
+                    std::filesystem::remove(it->path(), entry_error);
+                continue;
+            }
+            if (it->path().extension() != ".vfib")
+                continue;
+            const std::uint64_t size = std::filesystem::file_size(it->path(), entry_error);
+            if (!entry_error)
+                entries.push_back({it->path(), size, time, name.size() > suffix.size() &&
+                                   name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0});
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return a.is_current != b.is_current ? !a.is_current : a.time < b.time;
+        });
+        std::uint64_t size = 0;
+        for (const auto& entry : entries)
+            size += entry.size;
+        std::size_t number_of_entries = entries.size();
+        for (const auto& entry : entries)
+        {
+            if (entry.is_current && size <= max_size_ && number_of_entries <= max_number_of_entries_)
+                break;
+            std::filesystem::remove(entry.path, error);
+            size -= entry.size;
+            --number_of_entries;
+        }
+    }
+};
+
+/**
+ * @brief ParseCache::ParseCache ctor of the class. The directory is created when the first entry is written.
+ * @param directory The directory of the entries. It should not be used for other files.
+ * @param max_size The maximum size of the entries, in bytes.
+ * @param max_number_of_entries The maximum number of entries.
+ */
+ParseCache::ParseCache(const std::string& directory,
+                       const std::uint64_t& max_size,
+                       const std::size_t& max_number_of_entries)
+{
+    if (directory.empty())
+        throw std::runtime_error("ParseCache: The directory cannot be empty!");
+    impl_ = std::make_shared<ParseCache::Impl>();
+    impl_->directory_ = directory;
+    impl_->max_size_ = max_size;
+    impl_->max_number_of_entries_ = max_number_of_entries;
+}
+
+/**
+ * @brief ParseCache::load gets the data of a configuration file from its entry or, on a cache miss, with
+ *        the parse function, and then writes the entry. The entry is not written if the file is modified
+ *        while it is parsed, or if it exceeds the size limit, and the errors of the cache directory are
+ *        ignored. The content digest is not a cryptographic hash, so the directory must not be writable by
+ *        untrusted users.
+ * @param config_file The name of the file including its path and format.
+ * @param parse The function that parses the file on a cache miss. Its errors are rethrown.
+ * @param data The data of the file.
+ * @param vfi_file_version The vfi_file_version of the file.
+ * @param zero_indexed The zero indexed flag of the file.
+ * @return True if the data was read from the cache. False if the file was parsed.
+ */
+bool ParseCache::load(const std::string& config_file,
+                      const Parse& parse,
+                      std::vector<VFIConfigurationFile::Data>& data,
+                      int& vfi_file_version,
+                      bool& zero_indexed)
+{
+    ConstraintJournal::Fingerprint fingerprint;
+    std::string content;
+    try {
+        fingerprint = ConstraintJournal::get_fingerprint(config_file);
+    } catch (const std::exception&) {
+        // Let the parser report the error
+    }
+    if (!Impl::_read_file(config_file, content) || content.size() != fingerprint.size)
+    {
+        ++impl_->number_of_misses_;
+        parse(data, vfi_file_version, zero_indexed);
+        return false;
+    }
+
+    const auto path = impl_->_entry_path(content);
+    if (Impl::_read_entry(path, data, vfi_file_version, zero_indexed))
+    {
+        ++impl_->number_of_hits_;
+        return true;
+    }
+    ++impl_->number_of_misses_;
+    parse(data, vfi_file_version, zero_indexed);
+    try {
+        if (ConstraintJournal::get_fingerprint(config_file) == fingerprint &&
+            impl_->_write_entry(path, data, vfi_file_version, zero_indexed))
+            impl_->_evict();
+    } catch (const std::exception&) {
+        // The cache is an optimization: a read-only or full directory only costs the next parse
+    }
+    return false;
+}
+
+/**
+ * @brief ParseCache::clear removes every entry of the cache directory.
+ */
+void ParseCache::clear()
+{
+    std::error_code error;
+    for (std::filesystem::directory_iterator it(impl_->directory_, error), end; !error && it != end; it.increment(error))
+    {
+        std::error_code entry_error;
+        if (it->path().extension() == ".vfib" || _is_temporary_file(it->path().filename().string()))
+            std::filesystem::remove(it->path(), entry_error);
+    }
+}
+
+std::string ParseCache::get_directory() const
+{
+    return impl_->directory_.string();
+}
+
+std::uint64_t ParseCache::get_max_size() const
+{
+    return impl_->max_size_;
+}
+
+std::size_t ParseCache::get_max_number_of_entries() const
+{
+    return impl_->max_number_of_entries_;
+}
+
+/**
+ * @brief ParseCache::get_number_of_hits gets the number of loads of this object that read an entry.
+ */
+std::size_t ParseCache::get_number_of_hits() const
+{
+    return impl_->number_of_hits_;
+}
+
+/**
+ * @brief ParseCache::get_number_of_misses gets the number of loads of this object that parsed the file.
+ */
+std::size_t ParseCache::get_number_of_misses() const
+{
+    return impl_->number_of_misses_;
+}
+
+}
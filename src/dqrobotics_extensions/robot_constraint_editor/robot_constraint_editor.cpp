@@ -22,8 +22,29 @@
 */
 
 #include <dqrobotics_extensions/robot_constraint_editor/robot_constraint_editor.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_data_fields.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
-#include <map>
+#include <mutex>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include "change_notifier.hpp"
+#include "constraint_changes.hpp"
+#include "constraint_history.hpp"
+#include "constraint_indices.hpp"
+#include "constraint_journal.hpp"
+#include "constraint_snapshot_builder.hpp"
+#include "file_watcher.hpp"
+#include "journal_writer.hpp"
+#include "constraint_store.hpp"
+#include "parallel_for.hpp"
 
 
 
@@ -31,11 +52,48 @@
 namespace DQ_robotics_extensions
 {
 
+/**
+ * @brief assign_field assigns a value to the I-th field of a struct. Implicit conversions
+ *        (int to double, etc.) are allowed.
+ */
+template<typename DataType, typename T, std::size_t I>
+static void assign_field(DataType& data, const T& value)
+{
+    using FieldType = VFIDataFields::field_type<DataType, I>;
+    const auto& field = std::get<I>(VFIDataFields::Table<DataType>::fields);
+
+    // Check if types are compatible
+    if constexpr (std::is_same_v<FieldType, T> || std::is_convertible_v<T, FieldType>) {
+        data.*field.member = value;
+    } else {
+        throw std::runtime_error(std::string("Type mismatch for field '").append(field.name) +
+                                 "'. Expected: " + typeid(FieldType).name() +
+                                 ", Got: " + typeid(T).name());
+    }
+}
+
+template<typename DataType, typename T, std::size_t... I>
+static constexpr std::array<void (*)(DataType&, const T&), sizeof...(I)> make_field_setters(std::index_sequence<I...>)
+{
+    return {&assign_field<DataType, T, I>...};
+}
+
+/**
+ * @brief field_setters is a table of functions that assign a value of type T to each field of a struct,
+ *        indexed like VFIDataFields::Table<DataType>::fields.
+ */
+template<typename DataType, typename T>
+constexpr auto field_setters = make_field_setters<DataType, T>(std::make_index_sequence<VFIDataFields::size<DataType>()>());
+
 // Explicit instantiations for all expected types
 template void RobotConstraintEditor::edit_data<int>(const std::string&, const std::string&, const int&);
 template void RobotConstraintEditor::edit_data<double>(const std::string&, const std::string&, const double&);
 template void RobotConstraintEditor::edit_data<std::string>(const std::string&, const std::string&, const std::string&);
 template void RobotConstraintEditor::edit_data<std::vector<std::string>>(const std::string&, const std::string&, const std::vector<std::string>&);
+template void RobotConstraintEditor::edit_data<int>(const std::string&, const FieldHandle&, const int&);
+template void RobotConstraintEditor::edit_data<double>(const std::string&, const FieldHandle&, const double&);
+template void RobotConstraintEditor::edit_data<std::string>(const std::string&, const FieldHandle&, const std::string&);
+template void RobotConstraintEditor::edit_data<std::vector<std::string>>(const std::string&, const FieldHandle&, const std::vector<std::string>&);
 
 
 
@@ -46,7 +104,47 @@ public:
     bool zero_indexed_ = true; // default value
     std::shared_ptr<VFIConfigurationFile> interface_;
 
-    std::map<std::string, VFIConfigurationFile::Data> yaml_raw_data_map_;
+    ConstraintStore store_;
+    ConstraintIndices indices_;
+    ConstraintChanges changes_;
+    ConstraintHistory history_;
+    ChangeNotifier notifier_;
+
+    // Serializes the writers (and the readers that copy the data). Recursive, since the public methods
+    // call each other.
+    std::recursive_mutex mutex_;
+    std::uint64_t version_ = 0;  // Incremented by every change of the store
+    std::size_t commit_nesting_ = 0;  // See CommitScope
+    ConstraintSnapshotBuilder snapshots_;
+    // The snapshot of the last modification, published by the writers once get_snapshot() was called.
+    // Accessed with std::atomic_load/store.
+    std::shared_ptr<const ConstraintSnapshot> published_ = std::make_shared<const ConstraintSnapshot>();
+    std::atomic<bool> is_publishing_{false};
+
+    // The file written by the last full save (or read by the last load), which the changes are saved
+    // against by save_changes(). Empty if the data does not match any file.
+    std::string base_file_;
+    int base_vfi_file_version_ = 0;
+    bool base_zero_indexed_ = false;
+    ConstraintJournal::Fingerprint base_fingerprint_;
+    std::size_t number_of_delta_entries_ = 0;  // Entries in the delta journal of base_file_
+    std::uint64_t delta_valid_size_ = 0;       // Valid bytes of the delta journal when read, 0 once trimmed
+    std::size_t compaction_threshold_ = 1024;
+
+    // The write-ahead journal of base_file_ (see start_journal()), or nullptr
+    std::unique_ptr<JournalWriter> journal_;
+    std::chrono::microseconds journal_commit_interval_{0};
+
+    // The files reloaded by reload_data(): the hash of their content and their tags at the last reload
+    struct ReloadedFile{
+        std::size_t content_hash;
+        std::vector<std::string> tags;
+    };
+    std::unordered_map<std::string, ReloadedFile> reloaded_files_;
+
+    // The watchers of start_watching(). Declared last, so that their threads, which use the other members,
+    // are joined first.
+    std::vector<std::unique_ptr<FileWatcher>> watchers_;
 
     /**
      * @brief _is_the_same_type checks if two RawData structures have the same type.
@@ -64,10 +162,8 @@ public:
      * @param raw_data
      * @return The desired tag
      */
-    std::string _extract_tag(const VFIConfigurationFile::Data& raw_data) {
-        return std::visit([](auto&& arg) -> std::string {
-            return arg.tag;
-        }, raw_data);
+    const std::string& _extract_tag(const VFIConfigurationFile::Data& raw_data) {
+        return ConstraintStore::tag_of(raw_data);
     }
 
     /**
@@ -75,15 +171,644 @@ public:
      * @param tag The tag to check
      * @return True if the tag is on the map. False otherwise.
      */
-    bool is_tag_in_map(const std::string& tag)
+    bool is_tag_in_map(const std::string& tag) const
+    {
+        return store_.contains(tag);
+    }
+
+    /**
+     * @brief _rename_tag updates the tag of the data stored at a given index.
+     * @param index The index of the data in the store.
+     * @param new_tag The new tag.
+     */
+    void _rename_tag(const std::size_t& index, const std::string& new_tag)
+    {
+        const std::string old_tag = _extract_tag(store_[index]);
+        auto previous = _previous(index);
+        if (!store_.rename(index, new_tag))
+            throw std::runtime_error("Tag '" + new_tag + "' is being used!");
+        changes_.rename(index, old_tag);
+        _changed(index);
+        if (previous)
+        {
+            notifier_.changed(*previous, store_[index]);
+            history_.record({new_tag, std::move(previous)});
+        }
+        if (journal_)
+        {
+            _journal(journal_->append_remove(old_tag));
+            _journal(journal_->append_upsert(store_[index]));
+        }
+    }
+
+    /**
+     * @brief _reserve reserves memory in the store and in the indices for a number of constraints.
+     */
+    void _reserve(const std::size_t& size)
+    {
+        store_.reserve(size);
+        indices_.reserve(size);
+        changes_.reserve(size);
+    }
+
+    /**
+     * @brief _insert adds a constraint to the store and to the indices, if its tag is not used.
+     * @return True if the constraint was added. False if the tag is being used.
+     */
+    template<typename DataType>
+    bool _insert(DataType&& data)
+    {
+        if (!store_.insert(std::forward<DataType>(data)))
+            return false;
+        indices_.insert(store_.size() - 1, store_[store_.size() - 1]);
+        changes_.insert(store_.size() - 1);
+        _changed(store_.size() - 1);
+        notifier_.added(_extract_tag(store_[store_.size() - 1]));
+        if (history_.is_recording())
+            history_.record({_extract_tag(store_[store_.size() - 1]), std::nullopt});
+        if (journal_)
+            _journal(journal_->append_upsert(store_[store_.size() - 1]));
+        return true;
+    }
+
+    /**
+     * @brief _adopt moves the constraints of a vector into the store, without copying them.
+     *        The constraints before a repeated tag are kept, as in add_data().
+     */
+    void _adopt(std::vector<VFIConfigurationFile::Data>&& vector_data)
+    {
+        _reserve(store_.size() + vector_data.size());
+        for (auto& data : vector_data)
+            if (!_insert(std::move(data)))
+                throw std::runtime_error("Tag '" + _extract_tag(data) + "' is being used!");
+    }
+
+    /**
+     * @brief _erase removes a constraint from the store and from the indices.
+     * @return True if the constraint was removed. False if the tag was not found.
+     */
+    bool _erase(const std::string& tag)
+    {
+        const std::size_t index = store_.find(tag);
+        if (index == ConstraintStore::npos)
+            return false;
+        const std::size_t last = store_.size() - 1;
+        changes_.erase(index, tag);
+        notifier_.removed(tag);
+        if (history_.is_recording())
+            history_.record({std::nullopt, store_[index]});
+        if (journal_)
+            _journal(journal_->append_remove(tag));
+        store_.erase(tag);
+        // The store moves its last constraint to the removed index
+        indices_.erase(index);
+        if (index != last)
+        {
+            indices_.move(last, index);
+            changes_.move(last, index);
+        }
+        _changed(index);
+        _changed(last);
+        return true;
+    }
+
+    /**
+     * @brief _replace replaces several constraints at once (see ConstraintStore::replace()) and updates
+     *        the indices.
+     */
+    void _replace(std::vector<std::pair<std::size_t, VFIConfigurationFile::Data>>& replacements)
+    {
+        std::vector<VFIConfigurationFile::Data> previous;
+        if (history_.is_recording() || notifier_.is_active())
+        {
+            previous.reserve(replacements.size());
+            for (const auto& replacement : replacements)
+                previous.push_back(store_[replacement.first]);
+        }
+        for (const auto& replacement : replacements)
+        {
+            const std::string& old_tag = _extract_tag(store_[replacement.first]);
+            if (old_tag != _extract_tag(replacement.second))
+            {
+                changes_.rename(replacement.first, old_tag);
+                // All the removals go before the upserts, since a batch may give an old tag to another constraint
+                if (journal_)
+                    _journal(journal_->append_remove(old_tag));
+            }
+            else
+                changes_.update(replacement.first);
+        }
+        store_.replace(replacements);
+        if (notifier_.is_active())
+        {
+            std::vector<std::pair<const VFIConfigurationFile::Data*, const VFIConfigurationFile::Data*>> changes;
+            changes.reserve(replacements.size());
+            for (std::size_t i = 0; i < replacements.size(); ++i)
+                changes.emplace_back(&previous[i], &store_[replacements[i].first]);
+            notifier_.changed(changes);
+        }
+        for (std::size_t i = 0; i < replacements.size(); ++i)
+        {
+            const std::size_t index = replacements[i].first;
+            indices_.update(index, store_[index]);
+            _changed(index);
+            if (!previous.empty())
+                history_.record({_extract_tag(store_[index]), std::move(previous[i]), i > 0});
+            if (journal_)
+                _journal(journal_->append_upsert(store_[index]));
+        }
+    }
+
+    /**
+     * @brief _rename_entity replaces an entity name in a cs_entity list. If the new name is already in
+     *        the list, the old one is removed instead, so the list has no repeated names.
+     * @return True if the list was modified.
+     */
+    static bool _rename_entity(std::vector<std::string>& entities,
+                               const std::string& old_entity,
+                               const std::string& new_entity)
+    {
+        const auto it = std::find(entities.begin(), entities.end(), old_entity);
+        if (it == entities.end())
+            return false;
+        if (std::find(entities.begin(), entities.end(), new_entity) != entities.end())
+            entities.erase(std::remove(entities.begin(), entities.end(), old_entity), entities.end());
+        else
+            std::replace(it, entities.end(), old_entity, new_entity);
+        return true;
+    }
+
+    /**
+     * @brief _update reports the modification of the constraint at a store index.
+     * @param index The store index.
+     * @param is_indexed True if a field used by the secondary indices may have changed.
+     * @param previous The data before the modification, from _previous().
+     */
+    void _update(const std::size_t& index,
+                 const bool& is_indexed,
+                 std::optional<VFIConfigurationFile::Data>&& previous)
+    {
+        if (is_indexed)
+            indices_.update(index, store_[index]);
+        changes_.update(index);
+        _changed(index);
+        if (previous)
+        {
+            notifier_.changed(*previous, store_[index]);
+            history_.record({_extract_tag(store_[index]), std::move(previous)});
+        }
+        if (journal_)
+            _journal(journal_->append_upsert(store_[index]));
+    }
+
+    /**
+     * @brief The CommitScope class ends the outermost modification of the editor: it compacts the write-ahead
+     *        journal if needed, once per modification rather than once per change, and publishes a snapshot of
+     *        the data, so that get_snapshot() never waits for a writer. The editor must be locked.
+     */
+    class CommitScope{
+        Impl& impl_;
+    public:
+        explicit CommitScope(Impl& impl)
+            : impl_(impl)
+        {
+            ++impl_.commit_nesting_;
+        }
+        ~CommitScope()
+        {
+            if (--impl_.commit_nesting_ > 0)
+                return;
+            impl_._compact_journal_if_needed();
+            if (impl_.is_publishing_.load(std::memory_order_relaxed))
+                impl_._publish();
+        }
+        CommitScope(const CommitScope&) = delete;
+        CommitScope& operator=(const CommitScope&) = delete;
+    };
+
+    /**
+     * @brief The EditScope class wraps a modification of the editor: it locks the editor, and groups the
+     *        changes in one undo record and one batch of change events. The snapshot is published and the
+     *        events are delivered before the editor is unlocked.
+     */
+    class EditScope{
+        std::lock_guard<std::recursive_mutex> lock_;
+        ConstraintHistory::Scope history_;
+        ChangeNotifier::Scope notification_;
+        CommitScope commit_;  // Destroyed first, so that the subscribers can read the new snapshot
+    public:
+        explicit EditScope(Impl& impl, const ConstraintHistory::MODE& mode = ConstraintHistory::MODE::EDIT)
+            : lock_(impl.mutex_), history_(impl.history_, mode), notification_(impl.notifier_), commit_(impl)
+        {
+
+        }
+    };
+
+    /**
+     * @brief _changed reports to the snapshot builder that the constraint at a store index changed, and
+     *        updates the version of the data.
+     */
+    void _changed(const std::size_t& index)
+    {
+        snapshots_.mark(index);
+        ++version_;
+    }
+
+    /**
+     * @brief _publish publishes a snapshot of the data, if it changed since the last one. Only the chunks
+     *        of constraints that changed are copied (see ConstraintSnapshotBuilder).
+     */
+    void _publish()
+    {
+        if (std::atomic_load(&published_)->get_version() != version_)
+            std::atomic_store(&published_, std::make_shared<const ConstraintSnapshot>(snapshots_.build(store_, version_)));
+    }
+
+    /**
+     * @brief _previous returns a copy of the constraint at a store index for the undo history and the
+     *        change events, or nothing if neither is being recorded.
+     */
+    std::optional<VFIConfigurationFile::Data> _previous(const std::size_t& index) const
+    {
+        if (!history_.is_recording() && !notifier_.is_active())
+            return std::nullopt;
+        return store_[index];
+    }
+
+    /**
+     * @brief _apply applies the steps of a history record in reverse order, which undoes the edit that
+     *        recorded them. The steps of a batch are applied by a single _replace(), since the batch may
+     *        have swapped tags. The hooks record the inverse steps, i.e., the record that redoes the edit.
+     */
+    void _apply(ConstraintHistory::Record&& record)
+    {
+        std::size_t end = record.size();
+        while (end > 0)
+        {
+            auto& step = record[end - 1];
+            if (!step.tag)
+            {
+                _insert(std::move(*step.data));
+                --end;
+            }
+            else if (!step.data)
+            {
+                _erase(*step.tag);
+                --end;
+            }
+            else
+            {
+                std::size_t begin = end - 1;
+                while (record[begin].is_batched)
+                    --begin;
+                std::vector<std::pair<std::size_t, VFIConfigurationFile::Data>> replacements;
+                replacements.reserve(end - begin);
+                for (std::size_t i = begin; i < end; ++i)
+                    replacements.emplace_back(store_.find(*record[i].tag), std::move(*record[i].data));
+                _replace(replacements);
+                end = begin;
+            }
+        }
+    }
+
+    /**
+     * @brief _journal records the number of entries of the write-ahead journal after an append.
+     */
+    void _journal(const std::uint64_t& number_of_entries)
+    {
+        number_of_delta_entries_ = number_of_entries;
+    }
+
+    /**
+     * @brief _start_journal starts the write-ahead journal of base_file_, which must be saved.
+     */
+    void _start_journal()
+    {
+        if (base_file_.empty())
+            throw std::runtime_error("RobotConstraintEditor::start_journal: The data was not saved to a file!");
+        _trim_delta();
+        journal_ = std::make_unique<JournalWriter>(ConstraintJournal::path_of(base_file_, ".delta"), base_fingerprint_,
+                                                   number_of_delta_entries_, journal_commit_interval_,
+                                                   FileWriter::SYNC_POLICY::SYNC_EACH_FILE);
+        changes_.set_tracking(false);
+    }
+
+    /**
+     * @brief _trim_delta truncates the torn tail, if any, of the delta journal of base_file_ before the first
+     *        append to it. Loads never modify the journal, since another process may be appending to it.
+     */
+    void _trim_delta()
+    {
+        if (delta_valid_size_ == 0)
+            return;
+        ConstraintJournal::truncate(ConstraintJournal::path_of(base_file_, ".delta"), delta_valid_size_);
+        delta_valid_size_ = 0;
+    }
+
+    /**
+     * @brief _stop_journal writes the buffered entries of the write-ahead journal and stops it.
+     */
+    void _stop_journal()
+    {
+        auto journal = std::move(journal_);
+        changes_.set_tracking(true);
+        journal->stop();
+    }
+
+    /**
+     * @brief _save_base saves the whole data to a file, which becomes the base file, and removes its delta
+     *        journal. The write-ahead journal, if any, is restarted on the new base file.
+     */
+    void _save_base(const std::string& file, const int& vfi_file_version, const bool& zero_indexed)
+    {
+        const bool has_journal = journal_ != nullptr;
+        if (has_journal)
+            _stop_journal();
+        interface_->save_data(_ordered_data(), vfi_file_version, zero_indexed, file);
+        // The delta journal of the previous version of the file no longer applies
+        ConstraintJournal::remove(ConstraintJournal::path_of(file, ".delta"));
+        _set_base(file, vfi_file_version, zero_indexed, ConstraintJournal::ReadResult());
+        if (has_journal)
+            _start_journal();
+    }
+
+    /**
+     * @brief _compact_journal_if_needed replaces the write-ahead journal with a full save (a snapshot) of the
+     *        base file when the journal exceeds the compaction threshold. It is called at the end of the outermost
+     *        modification (see CommitScope), so a batch is not split by a snapshot, and it cannot throw. If the
+     *        snapshot fails, the error is printed to std::cerr and the journal is stopped (see is_journal_active()):
+     *        the journal keeps the changes until then, and the later ones are saved by save_changes().
+     */
+    void _compact_journal_if_needed() noexcept
+    {
+        if (!journal_ || number_of_delta_entries_ <= compaction_threshold_)
+            return;
+        try {
+            _save_base(base_file_, base_vfi_file_version_, base_zero_indexed_);
+        } catch (const std::exception& e) {
+            // _save_base() stopped the journal before the failure
+            std::cerr << "RobotConstraintEditor: Fail to compact the journal: " << e.what() << std::endl;
+        }
+    }
+
+    /**
+     * @brief _read_delta applies the delta journal of a configuration file (see save_changes()) to its
+     *        constraints. A backend may load from something other than a file, which has no journal.
+     */
+    static ConstraintJournal::ReadResult _read_delta(const std::string& config_file,
+                                                     std::vector<VFIConfigurationFile::Data>& data)
+    {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(config_file, error))
+            return ConstraintJournal::ReadResult();
+        return ConstraintJournal::read(ConstraintJournal::path_of(config_file, ".delta"),
+                                       ConstraintJournal::get_fingerprint(config_file), data);
+    }
+
+    /**
+     * @brief _set_base records that the data matches a file, plus the entries of its delta journal. If the
+     *        backend did not use a file, the data does not match any file.
+     */
+    void _set_base(const std::string& file,
+                   const int& vfi_file_version,
+                   const bool& zero_indexed,
+                   const ConstraintJournal::ReadResult& delta)
+    {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(file, error))
+        {
+            base_file_.clear();
+            return;
+        }
+        base_file_ = file;
+        base_vfi_file_version_ = vfi_file_version;
+        base_zero_indexed_ = zero_indexed;
+        base_fingerprint_ = ConstraintJournal::get_fingerprint(file);
+        number_of_delta_entries_ = delta.number_of_entries;
+        delta_valid_size_ = delta.valid_size;
+        changes_.clear(store_.size());
+    }
+
+    /**
+     * @brief _can_save_changes checks if the changes can be appended to the delta journal of a file,
+     *        instead of saving the whole data.
+     */
+    bool _can_save_changes(const std::string& file, const int& vfi_file_version, const bool& zero_indexed) const
     {
-        return (yaml_raw_data_map_.find(tag) == yaml_raw_data_map_.end()) ? false : true;
+        if (file != base_file_ || vfi_file_version != base_vfi_file_version_ || zero_indexed != base_zero_indexed_ ||
+            number_of_delta_entries_ + changes_.size() > compaction_threshold_)
+            return false;
+        // The file must not have been modified by someone else
+        std::error_code error;
+        return std::filesystem::exists(file, error) && ConstraintJournal::get_fingerprint(file) == base_fingerprint_;
+    }
+
+    /**
+     * @brief _replace_data replaces the constraint with a tag (see RobotConstraintEditor::replace_data()).
+     */
+    template<typename DataType>
+    void _replace_data(const std::string& tag, DataType&& data)
+    {
+        try{
+            const std::size_t index = store_.find(tag);
+            if (index == ConstraintStore::npos)
+                throw std::runtime_error("Tag '" + tag + "' not found!");
+            const std::string& new_tag = _extract_tag(data);
+            if (new_tag != tag && is_tag_in_map(new_tag))
+                throw std::runtime_error("Tag '" + new_tag + "' is being used!");
+            // Not an initializer list, whose elements would be copied
+            std::vector<std::pair<std::size_t, VFIConfigurationFile::Data>> replacement;
+            replacement.emplace_back(index, std::forward<DataType>(data));
+            _replace(replacement);
+        } catch (const std::runtime_error& e) {
+            std::cerr<<e.what()<<std::endl;
+            throw std::runtime_error("RobotConstraintEditor::edit_data: Fail to update the VFI data!");
+        }
+    }
+
+    /**
+     * @brief _content_hash returns the hash of the content of a file.
+     */
+    static std::size_t _content_hash(const std::string& file)
+    {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream)
+            throw std::runtime_error("Fail to open '" + file + "'!");
+        std::string content;
+        content.resize(std::filesystem::file_size(file));
+        stream.read(content.data(), static_cast<std::streamsize>(content.size()));
+        content.resize(static_cast<std::size_t>(stream.gcount()));
+        return std::hash<std::string_view>()(content);
+    }
+
+    /**
+     * @brief _reload applies the differences between a configuration file and the editor (see
+     *        RobotConstraintEditor::reload_data()).
+     * @return The number of constraints that were added, removed or replaced.
+     */
+    std::size_t _reload(const std::string& config_file)
+    {
+        if (!interface_)
+            throw std::runtime_error("The VFIConfigurationFile pointer is undefined!");
+        std::size_t content_hash = _content_hash(config_file);
+        {
+            const std::lock_guard<std::recursive_mutex> lock(mutex_);
+            const auto reloaded = reloaded_files_.find(config_file);
+            if (reloaded != reloaded_files_.end() && reloaded->second.content_hash == content_hash)
+                return 0;
+        }
+
+        // The file is parsed without locking the editor. The backend reads the file again, so the content is
+        // hashed after the parse too: if the file changed meanwhile, the hash may not match the parsed data,
+        // and the file is parsed again.
+        constexpr std::size_t max_attempts = 3;
+        std::shared_ptr<VFIConfigurationFile> interface;
+        for (std::size_t attempt = 1; ; ++attempt)
+        {
+            interface = interface_->new_instance();
+            interface->load_data(config_file);
+            const std::size_t parsed_hash = _content_hash(config_file);
+            if (parsed_hash == content_hash)
+                break;
+            if (attempt == max_attempts)
+                throw std::runtime_error("'" + config_file + "' keeps changing while it is parsed!");
+            content_hash = parsed_hash;
+        }
+        auto data = interface->take_data();
+        const auto delta = _read_delta(config_file, data);
+        std::unordered_set<std::string_view> tags;
+        tags.reserve(data.size());
+        for (const auto& new_data : data)
+            if (!tags.insert(_extract_tag(new_data)).second)
+                throw std::runtime_error("Tag '" + _extract_tag(new_data) + "' is repeated in '" + config_file + "'!");
+
+        EditScope scope(*this);
+        // Without a previous reload, the constraints of the file are the ones loaded from it, if any
+        const bool is_base = base_file_ == config_file;
+        std::vector<std::string> previous_tags;
+        const auto reloaded = reloaded_files_.find(config_file);
+        if (reloaded != reloaded_files_.end())
+            previous_tags = std::move(reloaded->second.tags);
+        else if (is_base)
+            for (std::size_t i = 0; i < store_.size(); ++i)
+                previous_tags.push_back(_extract_tag(store_[i]));
+
+        // The file only replaces its own constraints: a tag that it did not define before may belong to
+        // another file, or to a constraint added to the editor
+        const std::unordered_set<std::string_view> owned_tags(previous_tags.begin(), previous_tags.end());
+        std::string conflicts;
+        for (const auto& new_data : data)
+        {
+            const std::string& tag = _extract_tag(new_data);
+            if (!owned_tags.count(tag) && store_.find(tag) != ConstraintStore::npos)
+                conflicts += "\n  Tag '" + tag + "' in '" + config_file + "' is being used!";
+        }
+        if (!conflicts.empty())
+        {
+            if (reloaded != reloaded_files_.end())
+                reloaded->second.tags = std::move(previous_tags);
+            throw std::runtime_error("Repeated tags. No data was changed!" + conflicts);
+        }
+
+        std::size_t number_of_changes = 0;
+        for (const auto& tag : previous_tags)
+            if (!tags.count(tag) && _erase(tag))
+                ++number_of_changes;
+        std::vector<std::string> file_tags;
+        file_tags.reserve(data.size());
+        std::vector<std::pair<std::size_t, VFIConfigurationFile::Data>> replacements;
+        for (auto& new_data : data)
+        {
+            file_tags.push_back(_extract_tag(new_data));
+            const std::size_t index = store_.find(file_tags.back());
+            if (index == ConstraintStore::npos)
+            {
+                _insert(std::move(new_data));
+                ++number_of_changes;
+            }
+            else if (!(store_[index] == new_data))
+                replacements.emplace_back(index, std::move(new_data));
+        }
+        _replace(replacements);
+        number_of_changes += replacements.size();
+
+        // If the editor holds exactly the constraints of its base file, it matches the new content
+        if (is_base && !journal_ && store_.size() == file_tags.size())
+            _set_base(config_file, interface->get_vfi_file_version(), interface->is_zero_indexed(), delta);
+        reloaded_files_[config_file] = {content_hash, std::move(file_tags)};
+        return number_of_changes;
+    }
+
+    /**
+     * @brief _view returns a view of the constraints at a list of store indexes.
+     */
+    ConstraintView _view(const std::vector<std::uint32_t>* indexes) const
+    {
+        if (!indexes)
+            return ConstraintView();
+        return ConstraintView(store_.data(), indexes->data(), indexes->size());
+    }
+
+    /**
+     * @brief _ordered_data returns a copy of the data sorted by tag.
+     */
+    std::vector<VFIConfigurationFile::Data> _ordered_data() const
+    {
+        std::vector<VFIConfigurationFile::Data> data;
+        data.reserve(store_.size());
+        for (const auto& index : store_.ordered())
+            data.push_back(store_[index]);
+        return data;
+    }
+
+    /**
+     * @brief _assign_field modifies the value of a key (other than the tag) in a data.
+     * @param raw_data The data to be edited.
+     * @param key The key you want to modify.
+     * @param value The new value of the key.
+     */
+    template<typename T>
+    static void _assign_field(VFIConfigurationFile::Data& raw_data, const std::string& key, const T& value)
+    {
+        std::visit([&](auto& arg) {
+            using DataType = std::decay_t<decltype(arg)>;
+            _assign_field(arg, VFIDataFields::find<DataType>(key), key, value);
+        }, raw_data);
+    }
+
+    /**
+     * @brief _assign_field modifies the value of a key (other than the tag) in a data, using a field handle.
+     */
+    template<typename T>
+    static void _assign_field(VFIConfigurationFile::Data& raw_data, const FieldHandle& field, const T& value)
+    {
+        std::visit([&](auto& arg) {
+            using DataType = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<DataType, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>)
+                _assign_field(arg, field.environment_to_robot_index_, field.key_, value);
+            else
+                _assign_field(arg, field.robot_to_robot_index_, field.key_, value);
+        }, raw_data);
+    }
+
+    template<typename DataType, typename T>
+    static void _assign_field(DataType& data, const std::size_t& field_index, const std::string& key, const T& value)
+    {
+        if (field_index == VFIDataFields::npos)
+            throw std::runtime_error("Key '" + key + "' not found for " + VFIDataFields::Table<DataType>::name);
+        field_setters<DataType, T>[field_index](data, value);
     }
 
     Impl()
     {
 
     };
+
+    explicit Impl(std::pmr::memory_resource* memory_resource)
+        : store_(memory_resource)
+    {
+
+    };
 };
 
 /**
@@ -94,45 +819,143 @@ RobotConstraintEditor::RobotConstraintEditor(const std::shared_ptr<VFIConfigurat
     impl_->interface_ = interface;
 }
 
+/**
+ * @brief RobotConstraintEditor::RobotConstraintEditor ctor of the class, with a memory resource for the
+ *        arrays of the constraint store (e.g. a std::pmr::monotonic_buffer_resource shared by a whole
+ *        editing session). The resource must outlive the editor. The constraints themselves keep their
+ *        std::string members; see VFIPmrData for structs whose strings also use the resource.
+ */
+RobotConstraintEditor::RobotConstraintEditor(const std::shared_ptr<VFIConfigurationFile> &interface,
+                                             std::pmr::memory_resource* memory_resource) {
+    impl_ = std::make_shared<RobotConstraintEditor::Impl>(memory_resource);
+    impl_->interface_ = interface;
+}
+
 /**
  * @brief RobotConstraintEditor::load_data
  * @param config_file
  */
 void RobotConstraintEditor::load_data(const std::string& config_file)
 {
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    ChangeNotifier::Scope notification(impl_->notifier_);
+    Impl::CommitScope commit(*impl_);
     if (impl_->interface_)
     {
+        const bool was_empty = impl_->store_.size() == 0;
         impl_->interface_->load_data(config_file);
-        add_data(impl_->interface_->get_data());
+        auto data = impl_->interface_->take_data();
+        const auto delta = Impl::_read_delta(config_file, data);
+        // Loading is not undoable, and the previous edits may not be undoable after it
+        impl_->history_.clear();
+        impl_->_adopt(std::move(data));
+        // While the write-ahead journal runs, the loaded data is journaled like any other addition
+        if (impl_->journal_)
+            return;
+        if (was_empty)
+            impl_->_set_base(config_file, impl_->interface_->get_vfi_file_version(),
+                             impl_->interface_->is_zero_indexed(), delta);
+        else
+            impl_->base_file_.clear();
     }else
         throw std::runtime_error("The VFIConfigurationFile pointer is undefined!");
 }
 
+/**
+ * @brief RobotConstraintEditor::load_data loads several configuration files concurrently, and adds their
+ *        data to the editor. Each file is parsed by a new object created with VFIConfigurationFile::new_instance().
+ *        The tags are checked in the order of the files, and nothing is added if any file fails to load or
+ *        any tag is repeated. In that case, the error lists every repeated tag.
+ * @param config_files The files to load.
+ * @param number_of_threads The number of worker threads. Zero (default) means one thread per core.
+ */
+void RobotConstraintEditor::load_data(const std::vector<std::string>& config_files, const std::size_t& number_of_threads)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    ChangeNotifier::Scope notification(impl_->notifier_);
+    Impl::CommitScope commit(*impl_);
+    if (!impl_->interface_)
+        throw std::runtime_error("The VFIConfigurationFile pointer is undefined!");
+
+    std::vector<std::vector<VFIConfigurationFile::Data>> files_data(config_files.size());
+    parallel_for(config_files.size(), number_of_threads, [&](const std::size_t& i) {
+        try {
+            auto interface = impl_->interface_->new_instance();
+            interface->load_data(config_files[i]);
+            files_data[i] = interface->take_data();
+            Impl::_read_delta(config_files[i], files_data[i]);
+        } catch (const std::exception& e) {
+            throw std::runtime_error("RobotConstraintEditor::load_data: Fail to load '" + config_files[i] +
+                                     "': " + e.what());
+        }
+    });
+
+    // Check the tags before modifying the store, so that the errors do not depend on the thread scheduling
+    std::unordered_map<std::string_view, std::size_t> file_of_tag;
+    std::size_t total_size = 0;
+    std::string conflicts;
+    for (std::size_t i = 0; i < files_data.size(); ++i)
+    {
+        total_size += files_data[i].size();
+        for (const auto& data : files_data[i])
+        {
+            const std::string& tag = impl_->_extract_tag(data);
+            const auto [it, inserted] = file_of_tag.try_emplace(tag, i);
+            if (impl_->is_tag_in_map(tag))
+                conflicts += "\n  Tag '" + tag + "' in '" + config_files[i] + "' is being used!";
+            else if (!inserted)
+                conflicts += "\n  Tag '" + tag + "' in '" + config_files[i] + "' is also defined in '" +
+                             config_files[it->second] + "'";
+        }
+    }
+    if (!conflicts.empty())
+        throw std::runtime_error("RobotConstraintEditor::load_data: Repeated tags. No data was added!" + conflicts);
+
+    impl_->history_.clear();
+    impl_->_reserve(impl_->store_.size() + total_size);
+    for (auto& file_data : files_data)
+        for (auto& data : file_data)
+            impl_->_insert(std::move(data));
+    if (!impl_->journal_)
+        impl_->base_file_.clear();
+}
+
 /**
  * @brief RobotConstraintEditor::add_data adds data to compose the YAML file.
  * @param vector_data A vector containing VFIConfigurationFile::RawData elements
  */
 void  RobotConstraintEditor::add_data(const std::vector<VFIConfigurationFile::Data>& vector_data)
 {
+    Impl::EditScope scope(*impl_);
+    impl_->_reserve(impl_->store_.size() + vector_data.size());
     for (auto& data : vector_data)
         add_data(data);
 }
 
 /**
- * @brief RobotConstraintEditor::replace_data removes the data stored in the corresponding tag, and adds
- *              the new data. The new data will will be tagged automatically.
- * @param tag The tag of the data to be removed
+ * @brief RobotConstraintEditor::replace_data replaces the data stored in the corresponding tag by
+ *              the new data. The new data will will be tagged automatically. If the replacement fails,
+ *              the stored data is not modified.
+ * @param tag The tag of the data to be replaced
  * @param data The new data to add.
  */
 void RobotConstraintEditor::replace_data(const std::string& tag, const VFIConfigurationFile::Data& data)
 {
-    try{
-        remove_data(tag);
-        add_data(data);
-    } catch (const std::runtime_error& e) {
-        std::cerr<<e.what()<<std::endl;
-        throw std::runtime_error("RobotConstraintEditor::edit_data: Fail to update the VFI data!");
-    }
+    Impl::EditScope scope(*impl_);
+    impl_->_replace_data(tag, data);
+}
+
+/**
+ * @brief RobotConstraintEditor::replace_data replaces the data stored in the corresponding tag by
+ *              the new data, which is moved into the editor. If the replacement fails, neither the
+ *              stored data nor the new data are modified.
+ * @param tag The tag of the data to be replaced
+ * @param data The new data to add.
+ */
+void RobotConstraintEditor::replace_data(const std::string& tag, VFIConfigurationFile::Data&& data)
+{
+    Impl::EditScope scope(*impl_);
+    impl_->_replace_data(tag, std::move(data));
 }
 
 /**
@@ -141,10 +964,51 @@ void RobotConstraintEditor::replace_data(const std::string& tag, const VFIConfig
  */
 void RobotConstraintEditor::add_data(const VFIConfigurationFile::Data& data)
 {
-    const std::string tag = impl_->_extract_tag(data);
-    if (impl_->is_tag_in_map(tag))
-        throw std::runtime_error("Tag '" + tag + "' is being used!");
-    impl_->yaml_raw_data_map_.try_emplace(tag, data);
+    Impl::EditScope scope(*impl_);
+    if (!impl_->_insert(data))
+        throw std::runtime_error("Tag '" + impl_->_extract_tag(data) + "' is being used!");
+}
+
+/**
+ * @brief RobotConstraintEditor::add_data moves data into the editor, without copying its strings.
+ *        If the tag is being used, the data is not modified.
+ * @param data The data to add.
+ */
+void RobotConstraintEditor::add_data(VFIConfigurationFile::Data&& data)
+{
+    Impl::EditScope scope(*impl_);
+    if (!impl_->_insert(std::move(data)))
+        throw std::runtime_error("Tag '" + impl_->_extract_tag(data) + "' is being used!");
+}
+
+/**
+ * @brief RobotConstraintEditor::add_data moves the elements of a vector into the editor, reserving
+ *        memory for all of them first. The elements are added in order, and the ones before a repeated
+ *        tag are kept.
+ * @param vector_data A vector containing VFIConfigurationFile::Data elements. It is left with
+ *        moved-from elements.
+ */
+void RobotConstraintEditor::add_data(std::vector<VFIConfigurationFile::Data>&& vector_data)
+{
+    Impl::EditScope scope(*impl_);
+    impl_->_adopt(std::move(vector_data));
+}
+
+/**
+ * @brief RobotConstraintEditor::add_data adds the constraints of an InternedConstraintSet.
+ *        The constraints are added in the order of the set, and the ones before a repeated tag are kept.
+ * @param interned_data The constraints.
+ */
+void RobotConstraintEditor::add_data(const InternedConstraintSet& interned_data)
+{
+    Impl::EditScope scope(*impl_);
+    impl_->_reserve(impl_->store_.size() + interned_data.size());
+    VFIConfigurationFile::Data data;
+    for (std::size_t i = 0; i < interned_data.size(); ++i)
+    {
+        interned_data.get_data(i, data);
+        add_data(data);
+    }
 }
 
 /**
@@ -153,9 +1017,9 @@ void RobotConstraintEditor::add_data(const VFIConfigurationFile::Data& data)
  */
 void RobotConstraintEditor::remove_data(const std::string& tag)
 {
-    if (!impl_->is_tag_in_map(tag))
+    Impl::EditScope scope(*impl_);
+    if (!impl_->_erase(tag))
         throw std::runtime_error("Tag '" + tag + "' not found!");
-    impl_->yaml_raw_data_map_.erase(tag);
 }
 
 /**
@@ -167,129 +1031,129 @@ void RobotConstraintEditor::remove_data(const std::string& tag)
 template<typename T>
 void RobotConstraintEditor::edit_data(const std::string& tag, const std::string& key, const T& value)
 {
+    Impl::EditScope scope(*impl_);
     // Check if tag exists
-    if (!impl_->is_tag_in_map(tag))
+    const std::size_t index = impl_->store_.find(tag);
+    if (index == ConstraintStore::npos)
         throw std::runtime_error("Tag '" + tag + "' not found!");
 
-    auto& raw_data = impl_->yaml_raw_data_map_.at(tag);
-    bool modified = false;
+    if (key == "tag") {
+        if constexpr (std::is_same_v<T, std::string> ||
+                      std::is_convertible_v<T, std::string>) {
+            // Update the index of the store
+            impl_->_rename_tag(index, value);
+        } else {
+            throw std::runtime_error("Tag must be convertible to string");
+        }
+    } else {
+        auto previous = impl_->_previous(index);
+        Impl::_assign_field(impl_->store_[index], key, value);
+        impl_->_update(index, ConstraintIndices::is_indexed_key(key), std::move(previous));
+    }
+}
 
-    std::visit([&](auto&& arg) {
-        using DataType = std::decay_t<decltype(arg)>;
+/**
+ * @brief RobotConstraintEditor::edit_data applies a batch of edits atomically. The edits are applied in order
+ *        on a staged copy of the affected data, so a later edit sees the result of the earlier ones (including
+ *        tag changes). If any edit fails (unknown tag or key, type mismatch, or tag conflict), nothing is modified.
+ * @param edits The edits to apply.
+ */
+void RobotConstraintEditor::edit_data(const std::vector<EditOperation>& edits)
+{
+    Impl::EditScope scope(*impl_);
+    std::vector<std::pair<std::size_t, VFIConfigurationFile::Data>> staged;
+    std::unordered_map<std::size_t, std::size_t> staged_position;
+    // Tags changed by the batch. The value is the index of the data that owns the tag, or npos if it was vacated.
+    std::unordered_map<std::string, std::size_t> renamed_tags;
 
-        // Helper function to assign value with type checking
-        auto assign_if_match = [&](auto& field, const std::string& field_name) -> bool {
-            if (key != field_name) return false;
+    auto find_tag = [&](const std::string& tag) -> std::size_t {
+        const auto it = renamed_tags.find(tag);
+        return it != renamed_tags.end() ? it->second : impl_->store_.find(tag);
+    };
 
-            using FieldType = std::decay_t<decltype(field)>;
+    for (std::size_t i = 0; i < edits.size(); ++i)
+    {
+        const auto& edit = edits[i];
+        try {
+            const std::size_t index = find_tag(edit.tag);
+            if (index == ConstraintStore::npos)
+                throw std::runtime_error("Tag '" + edit.tag + "' not found!");
 
-            // Check if types are compatible
-            if constexpr (std::is_same_v<FieldType, T>) {
-                field = value;
-                return true;
-            } else if constexpr (std::is_convertible_v<T, FieldType>) {
-                field = value;  // Allow implicit conversions (int to double, etc.)
-                return true;
-            } else {
-                throw std::runtime_error("Type mismatch for field '" + key +
-                                         "'. Expected: " + typeid(FieldType).name() +
-                                         ", Got: " + typeid(T).name());
-            }
-        };
-
-        if constexpr (std::is_same_v<DataType, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
-            // String fields
-            if (assign_if_match(arg.vfi_type, "vfi_type")) modified = true;
-            else if (assign_if_match(arg.entity_environment_primitive_type, "entity_environment_primitive_type")) modified = true;
-            else if (assign_if_match(arg.entity_robot_primitive_type, "entity_robot_primitive_type")) modified = true;
-            else if (assign_if_match(arg.direction, "direction")) modified = true;
-
-            // Integer fields
-            else if (assign_if_match(arg.robot_index, "robot_index")) modified = true;
-            else if (assign_if_match(arg.joint_index, "joint_index")) modified = true;
-
-            // Double fields (also accept int via conversion)
-            else if (assign_if_match(arg.safe_distance, "safe_distance")) modified = true;
-            else if (assign_if_match(arg.buffer, "buffer")) modified = true;
-            else if (assign_if_match(arg.vfi_gain, "vfi_gain")) modified = true;
-
-            // Vector fields
-            else if (assign_if_match(arg.cs_entity_environment, "cs_entity_environment")) modified = true;
-            else if (assign_if_match(arg.cs_entity_robot, "cs_entity_robot")) modified = true;
-
-            // Special handling for tag - update map key
-            else if (key == "tag") {
-                if constexpr (std::is_same_v<T, std::string> ||
-                              std::is_convertible_v<T, std::string>) {
-                    std::string old_tag = arg.tag;
-                    arg.tag = value;
-
-                    // Update the map key
-                    auto node_handler = impl_->yaml_raw_data_map_.extract(old_tag);
-                    if (!node_handler.empty()) {
-                        node_handler.key() = value;
-                        impl_->yaml_raw_data_map_.insert(std::move(node_handler));
-                    }
-                    modified = true;
-                } else {
-                    throw std::runtime_error("Tag must be convertible to string");
-                }
-            }
-            else {
-                throw std::runtime_error("Key '" + key + "' not found for ENVIRONMENT_TO_ROBOT");
-            }
+            auto [position, inserted] = staged_position.try_emplace(index, staged.size());
+            if (inserted)
+                staged.emplace_back(index, impl_->store_[index]);
+            auto& raw_data = staged[position->second].second;
 
-        } else if constexpr (std::is_same_v<DataType, VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>) {
-            // String fields
-            if (assign_if_match(arg.vfi_type, "vfi_type")) modified = true;
-            else if (assign_if_match(arg.entity_one_primitive_type, "entity_one_primitive_type")) modified = true;
-            else if (assign_if_match(arg.entity_two_primitive_type, "entity_two_primitive_type")) modified = true;
-            else if (assign_if_match(arg.direction, "direction")) modified = true;
-
-            // Integer fields
-            else if (assign_if_match(arg.robot_index_one, "robot_index_one")) modified = true;
-            else if (assign_if_match(arg.robot_index_two, "robot_index_two")) modified = true;
-            else if (assign_if_match(arg.joint_index_one, "joint_index_one")) modified = true;
-            else if (assign_if_match(arg.joint_index_two, "joint_index_two")) modified = true;
-
-            // Double fields
-            else if (assign_if_match(arg.safe_distance, "safe_distance")) modified = true;
-            else if (assign_if_match(arg.buffer, "buffer")) modified = true;
-            else if (assign_if_match(arg.vfi_gain, "vfi_gain")) modified = true;
-
-            // Vector fields
-            else if (assign_if_match(arg.cs_entity_one, "cs_entity_one")) modified = true;
-            else if (assign_if_match(arg.cs_entity_two, "cs_entity_two")) modified = true;
-
-            // Special handling for tag
-            // IF the tag is modified, we need to update the new tag in the map.
-            else if (key == "tag") {
-                if constexpr (std::is_same_v<T, std::string> ||
-                              std::is_convertible_v<T, std::string>) {
-                    std::string old_tag = arg.tag;
-                    arg.tag = value;
-
-                    // Update the map key
-                    auto node_handler = impl_->yaml_raw_data_map_.extract(old_tag);
-                    if (!node_handler.empty()) {
-                        node_handler.key() = value;
-                        impl_->yaml_raw_data_map_.insert(std::move(node_handler));
-                    }
-                    modified = true;
-                } else {
+            if (edit.key == "tag") {
+                const auto new_tag = std::get_if<std::string>(&edit.value);
+                if (!new_tag)
                     throw std::runtime_error("Tag must be convertible to string");
-                }
-            }
-            else {
-                throw std::runtime_error("Key '" + key + "' not found for ROBOT_TO_ROBOT");
+                if (*new_tag == edit.tag)
+                    continue;
+                if (find_tag(*new_tag) != ConstraintStore::npos)
+                    throw std::runtime_error("Tag '" + *new_tag + "' is being used!");
+                renamed_tags[edit.tag] = ConstraintStore::npos;
+                renamed_tags[*new_tag] = index;
+                std::visit([&](auto& arg) { arg.tag = *new_tag; }, raw_data);
+            } else {
+                std::visit([&](const auto& value) {
+                    Impl::_assign_field(raw_data, edit.key, value);
+                }, edit.value);
             }
+        } catch (const std::runtime_error& e) {
+            std::cerr<<e.what()<<std::endl;
+            throw std::runtime_error("RobotConstraintEditor::edit_data: Edit " + std::to_string(i) +
+                                     " (tag '" + edit.tag + "', key '" + edit.key +
+                                     "') failed. No data was modified!");
         }
-    }, raw_data);
+    }
+    impl_->_replace(staged);
+}
 
-    if (!modified) {
-        throw std::runtime_error("Failed to edit field '" + key + "' for tag '" + tag + "'");
+/**
+ * @brief RobotConstraintEditor::edit_data modifies the value of a key in the specified tagged data.
+ * @param tag The tag that identifies the data to be edited.
+ * @param field The key you want to modify, obtained from get_field_handle().
+ * @param value The new value of the key.
+ */
+template<typename T>
+void RobotConstraintEditor::edit_data(const std::string& tag, const FieldHandle& field, const T& value)
+{
+    Impl::EditScope scope(*impl_);
+    const std::size_t index = impl_->store_.find(tag);
+    if (index == ConstraintStore::npos)
+        throw std::runtime_error("Tag '" + tag + "' not found!");
+
+    if (field.is_tag_) {
+        if constexpr (std::is_convertible_v<T, std::string>)
+            impl_->_rename_tag(index, value);
+        else
+            throw std::runtime_error("Tag must be convertible to string");
+    } else {
+        auto previous = impl_->_previous(index);
+        Impl::_assign_field(impl_->store_[index], field, value);
+        impl_->_update(index, field.is_indexed_, std::move(previous));
     }
+}
 
+/**
+ * @brief RobotConstraintEditor::get_field_handle resolves a key, so that it can be edited without
+ *        string comparisons. See edit_data(const std::string&, const FieldHandle&, const T&).
+ * @param key The key you want to modify.
+ * @return The field handle.
+ */
+RobotConstraintEditor::FieldHandle RobotConstraintEditor::get_field_handle(const std::string& key)
+{
+    FieldHandle field;
+    field.key_ = key;
+    field.environment_to_robot_index_ = VFIDataFields::find<VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(key);
+    field.robot_to_robot_index_ = VFIDataFields::find<VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>(key);
+    field.is_tag_ = key == "tag";
+    field.is_indexed_ = ConstraintIndices::is_indexed_key(key);
+    if (field.environment_to_robot_index_ == VFIDataFields::npos &&
+        field.robot_to_robot_index_ == VFIDataFields::npos)
+        throw std::runtime_error("Key '" + key + "' not found!");
+    return field;
 }
 
 
@@ -303,29 +1167,590 @@ void RobotConstraintEditor::save_data(const std::string& path_config_file,
                                       const int &vfi_file_version,
                                       const bool &zero_indexed)
 {
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
     if (impl_->interface_)
     {
-        std::vector<VFIConfigurationFile::Data> data;
-        data.reserve(impl_->yaml_raw_data_map_.size());
-        for (auto& pair : impl_->yaml_raw_data_map_)
-            data.push_back(pair.second);
-
-        impl_->interface_->save_data(data, vfi_file_version, zero_indexed, path_config_file);
+        if (impl_->journal_ && path_config_file != impl_->base_file_)
+        {
+            // An export, which does not change the file of the write-ahead journal
+            impl_->interface_->save_data(impl_->_ordered_data(), vfi_file_version, zero_indexed, path_config_file);
+            ConstraintJournal::remove(ConstraintJournal::path_of(path_config_file, ".delta"));
+        }
+        else
+            impl_->_save_base(path_config_file, vfi_file_version, zero_indexed);
     }else
         throw std::runtime_error("The VFIConfigurationFile pointer is undefined!");
 }
 
 /**
- * @brief RobotConstraintEditor::get_raw_data returns the raw data vector
+ * @brief RobotConstraintEditor::save_changes saves only the constraints that changed since the last save.
+ *        They are appended to a delta journal next to the file (path_config_file + ".delta"), which
+ *        load_data() replays transparently. The whole data is saved instead, with save_data(), when the
+ *        data was not loaded from or saved to this file with the same version and zero_indexed flag, when
+ *        the file was modified by someone else, or when the journal would exceed the compaction threshold
+ *        (see set_compaction_threshold()). A full save removes the journal.
+ *        While the write-ahead journal of the file is running (see start_journal()), it only waits until the
+ *        journal is written.
+ * @param path_config_file The path to the file, including its name and format.
+ * @param vfi_file_version The version you want to specify.
+ * @param zero_indexed The desired zero indexed flag you want to specify.
+ */
+void RobotConstraintEditor::save_changes(const std::string& path_config_file,
+                                         const int& vfi_file_version,
+                                         const bool& zero_indexed)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (impl_->journal_ && path_config_file == impl_->base_file_ &&
+        vfi_file_version == impl_->base_vfi_file_version_ && zero_indexed == impl_->base_zero_indexed_)
+    {
+        impl_->journal_->flush();
+        return;
+    }
+    if (!impl_->_can_save_changes(path_config_file, vfi_file_version, zero_indexed))
+    {
+        save_data(path_config_file, vfi_file_version, zero_indexed);
+        return;
+    }
+    if (impl_->changes_.empty())
+        return;
+
+    // Removals first, so that a tag that was removed and then added again ends up added
+    std::string entries;
+    for (const auto& tag : impl_->changes_.removed_tags())
+        ConstraintJournal::append_remove(entries, tag);
+    for (std::size_t index = 0; index < impl_->store_.size(); ++index)
+        if (impl_->changes_.is_changed(index))
+            ConstraintJournal::append_upsert(entries, impl_->store_[index]);
+    if (impl_->number_of_delta_entries_ > 0)
+        impl_->_trim_delta();
+    ConstraintJournal::write(ConstraintJournal::path_of(path_config_file, ".delta"), impl_->base_fingerprint_,
+                             entries, impl_->number_of_delta_entries_ > 0, FileWriter::SYNC_POLICY::SYNC_EACH_FILE);
+    impl_->number_of_delta_entries_ += impl_->changes_.size();
+    impl_->changes_.clear(impl_->store_.size());
+}
+
+/**
+ * @brief RobotConstraintEditor::set_compaction_threshold sets the maximum number of entries of the delta
+ *        journal written by save_changes(). When it would be exceeded, the whole data is saved instead.
+ * @param number_of_entries The threshold. Zero means that save_changes() always saves the whole data.
+ */
+void RobotConstraintEditor::set_compaction_threshold(const std::size_t& number_of_entries)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->compaction_threshold_ = number_of_entries;
+}
+
+std::size_t RobotConstraintEditor::get_compaction_threshold() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->compaction_threshold_;
+}
+
+/**
+ * @brief RobotConstraintEditor::start_journal starts an append-only journal of the changes of the data,
+ *        written ahead of the next save. Every addition, removal, replacement and edit is buffered and
+ *        written to path_config_file + ".delta" by a background thread, which groups the changes of each
+ *        commit interval in a single write and sync. After a crash, load_data(path_config_file) replays
+ *        the journal on top of the file. When an edit makes the journal exceed the compaction threshold (see
+ *        set_compaction_threshold()), the whole data is saved to the file (a snapshot) at the end of the edit,
+ *        and the journal starts over. If the snapshot fails, the error is printed to std::cerr and the journal
+ *        stops (see is_journal_active()). Use FileWriter::SAVE_MODE::ATOMIC in the VFIConfigurationFile, so that a crash
+ *        during a snapshot does not damage the file.
+ *        The changes that were not saved yet are saved first (see save_changes()).
+ * @param path_config_file The path to the file, including its name and format.
+ * @param vfi_file_version The version used by the snapshots.
+ * @param zero_indexed The zero indexed flag used by the snapshots.
+ * @param commit_interval The time the changes are buffered before they are written.
+ */
+void RobotConstraintEditor::start_journal(const std::string& path_config_file,
+                                          const int& vfi_file_version,
+                                          const bool& zero_indexed,
+                                          const std::chrono::microseconds& commit_interval)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (impl_->journal_)
+        throw std::runtime_error("RobotConstraintEditor::start_journal: The journal is already running!");
+    save_changes(path_config_file, vfi_file_version, zero_indexed);
+    impl_->journal_commit_interval_ = commit_interval;
+    impl_->_start_journal();
+}
+
+/**
+ * @brief RobotConstraintEditor::flush_journal waits until the buffered changes are written to the journal.
+ *        Throws a std::runtime_error if the journal could not be written.
+ */
+void RobotConstraintEditor::flush_journal()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (impl_->journal_)
+        impl_->journal_->flush();
+}
+
+/**
+ * @brief RobotConstraintEditor::stop_journal writes the buffered changes and stops the journal. The journal
+ *        file is kept, so that load_data() replays it. Later changes are saved with save_changes() or save_data().
+ */
+void RobotConstraintEditor::stop_journal()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (impl_->journal_)
+        impl_->_stop_journal();
+}
+
+bool RobotConstraintEditor::is_journal_active() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->journal_ != nullptr;
+}
+
+/**
+ * @brief RobotConstraintEditor::reload_data makes the constraints of the editor that come from a configuration
+ *        file match its current content, applying only the differences: the tags that are no longer in the
+ *        file are removed, the new tags are added, and the constraints that changed are replaced. The
+ *        constraints that come from the file are the ones of its last reload or, before that, the ones loaded
+ *        by load_data() if it is the only file of the editor. Only those constraints are replaced: if the file
+ *        now defines a tag that is used by another constraint of the editor (e.g. from another file, or added
+ *        with add_data()), a std::runtime_error lists the repeated tags and nothing is changed. The changes are
+ *        one edit (see undo()) and one batch of change events. The file is not parsed again while its content does not change. If it
+ *        changes while it is parsed, it is parsed again; a std::runtime_error is thrown if it keeps changing.
+ * @param config_file The file to reload. It is parsed by a new object created with VFIConfigurationFile::new_instance().
+ * @return The number of constraints that were added, removed or replaced.
+ */
+std::size_t RobotConstraintEditor::reload_data(const std::string& config_file)
+{
+    try {
+        return impl_->_reload(config_file);
+    } catch (const std::exception& e) {
+        throw std::runtime_error("RobotConstraintEditor::reload_data: Fail to reload '" + config_file +
+                                 "': " + e.what());
+    }
+}
+
+/**
+ * @brief RobotConstraintEditor::start_watching reloads a configuration file (see reload_data()), and then
+ *        reloads it from a background thread whenever it is modified (hot reload). The modifications are
+ *        detected with inotify and debounced, so that a file that is being written is reloaded once it
+ *        has not been modified for the debounce interval. The errors of the background reloads (e.g. a
+ *        file with invalid syntax) are printed to std::cerr, and the file is reloaded at its next modification.
+ *        Several files can be watched.
+ * @param config_file The file to watch.
+ * @param debounce_interval The time without modifications before the file is reloaded.
+ */
+void RobotConstraintEditor::start_watching(const std::string& config_file,
+                                           const std::chrono::milliseconds& debounce_interval)
+{
+    // Watch first, so that no modification is missed after the reload
+    auto watcher = std::make_unique<FileWatcher>(config_file, debounce_interval, [impl = impl_.get(), config_file]() {
+        impl->_reload(config_file);
+    });
+    reload_data(config_file);
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->watchers_.push_back(std::move(watcher));
+}
+
+/**
+ * @brief RobotConstraintEditor::stop_watching stops watching the files of start_watching(), waiting for a
+ *        reload in progress. It must not be called by a change callback (see subscribe()).
+ */
+void RobotConstraintEditor::stop_watching()
+{
+    std::vector<std::unique_ptr<FileWatcher>> watchers;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+        watchers.swap(impl_->watchers_);
+    }
+    // The watchers are destroyed without the lock, which their reloads need
+    watchers.clear();
+}
+
+bool RobotConstraintEditor::is_watching() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return !impl_->watchers_.empty();
+}
+
+/**
+ * @brief RobotConstraintEditor::has_unsaved_changes checks if the data changed since the last save or load.
+ * @return True if there are changes to save. False otherwise.
+ */
+bool RobotConstraintEditor::has_unsaved_changes() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return !impl_->changes_.empty() || (impl_->base_file_.empty() && impl_->store_.size() > 0);
+}
+
+/**
+ * @brief RobotConstraintEditor::undo reverts the last edit. Each call of add_data(), remove_data(),
+ *        replace_data(), edit_data() or rename_entity() is an edit. The history keeps the inverse of the
+ *        changes, so an undo costs as much as the edit it reverts, regardless of the number of constraints.
+ *        Loading data clears the history.
+ * @return True if an edit was reverted. False if there was nothing to undo.
+ */
+bool RobotConstraintEditor::undo()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (!impl_->history_.can_undo())
+        return false;
+    auto record = impl_->history_.pop_undo();
+    Impl::EditScope scope(*impl_, ConstraintHistory::MODE::UNDO);
+    impl_->_apply(std::move(record));
+    return true;
+}
+
+/**
+ * @brief RobotConstraintEditor::redo applies again the last edit reverted by undo(). A new edit discards
+ *        the edits that can be redone.
+ * @return True if an edit was applied. False if there was nothing to redo.
+ */
+bool RobotConstraintEditor::redo()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (!impl_->history_.can_redo())
+        return false;
+    auto record = impl_->history_.pop_redo();
+    Impl::EditScope scope(*impl_, ConstraintHistory::MODE::REDO);
+    impl_->_apply(std::move(record));
+    return true;
+}
+
+bool RobotConstraintEditor::can_undo() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->history_.can_undo();
+}
+
+bool RobotConstraintEditor::can_redo() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->history_.can_redo();
+}
+
+/**
+ * @brief RobotConstraintEditor::set_history_depth sets the maximum number of edits that can be undone
+ *        (default: 100). The oldest edits are forgotten first. Zero disables the history.
+ * @param depth The number of edits.
+ */
+void RobotConstraintEditor::set_history_depth(const std::size_t& depth)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->history_.set_depth(depth);
+}
+
+std::size_t RobotConstraintEditor::get_history_depth() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->history_.get_depth();
+}
+
+/**
+ * @brief RobotConstraintEditor::clear_history forgets the edits that can be undone or redone.
+ */
+void RobotConstraintEditor::clear_history()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->history_.clear();
+}
+
+/**
+ * @brief RobotConstraintEditor::subscribe registers a function that is called after each modification of
+ *        the data (e.g. each add_data(), edit_data(), undo() or load_data() call), with the events of the
+ *        modification. An addition or a removal is one event, and an edit is one event per modified key.
+ *        The renames of a batch edit are simultaneous, so they may swap tags.
+ *        The function is called on the thread that modified the editor, with the mutex of the editor held. It
+ *        may read the editor, but it must not modify it, and it must not throw (the exceptions are printed to
+ *        std::cerr). It must not wait for another thread that uses the editor either, since that thread would
+ *        wait for the mutex: a deadlock. Hand the events over to the other thread instead (e.g. with a queue).
+ * @param callback The function to call.
+ * @param coalesce If true, the events of the batch are merged before the call: one event per key of a
+ *        constraint, without the edits of the constraints added in the batch, and without the constraints
+ *        added and removed in it (see also pause_notifications()). The merged batch lists the removals
+ *        (with the tags before the batch), the renames (which are simultaneous), the other edits and the
+ *        additions, in this order.
+ * @return The subscription id, for unsubscribe().
+ */
+std::size_t RobotConstraintEditor::subscribe(const ChangeCallback& callback, const bool& coalesce)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->notifier_.subscribe(callback, coalesce);
+}
+
+/**
+ * @brief RobotConstraintEditor::unsubscribe removes a subscription.
+ * @param id The id returned by subscribe().
+ * @return True if the subscription was removed. False if the id was not found.
+ */
+bool RobotConstraintEditor::unsubscribe(const std::size_t& id)
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->notifier_.unsubscribe(id);
+}
+
+/**
+ * @brief RobotConstraintEditor::pause_notifications holds the events for the coalescing subscriptions
+ *        until resume_notifications(), which delivers them merged in a single batch. For instance, a view
+ *        that redraws at a fixed rate can pause the notifications between frames, and get the changes of
+ *        the whole frame. The other subscriptions still get a batch per modification.
+ */
+void RobotConstraintEditor::pause_notifications()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->notifier_.pause();
+}
+
+/**
+ * @brief RobotConstraintEditor::resume_notifications delivers the change events held since
+ *        pause_notifications() to the coalescing subscriptions, and resumes the delivery after each modification.
+ */
+void RobotConstraintEditor::resume_notifications()
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    impl_->notifier_.resume();
+}
+
+/**
+ * @brief RobotConstraintEditor::get_raw_data returns the raw data vector sorted by tag.
  * @return The desired vector
  */
 std::vector<VFIConfigurationFile::Data> RobotConstraintEditor::get_data()
 {
-    std::vector<VFIConfigurationFile::Data> raw_data;
-    raw_data.reserve(impl_->yaml_raw_data_map_.size());
-    for (auto& pair : impl_->yaml_raw_data_map_)
-        raw_data.push_back(pair.second);
-    return raw_data;
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_ordered_data();
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_view returns a read-only view of all the data, sorted by tag,
+ *        without copying it. The view is invalidated by any modification of the editor.
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_view() const
+{
+    // ordered() sorts a cache, so two readers must not call it at once
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    const auto& ordered = impl_->store_.ordered();
+    return ConstraintView(impl_->store_.data(), ordered.data(), ordered.size());
+}
+
+/**
+ * @brief RobotConstraintEditor::find_data looks for the data with a tag, without copying it.
+ *        The pointer is invalidated by any modification of the editor.
+ * @param tag The tag of the data.
+ * @return A pointer to the data, or nullptr if the tag is not found.
+ */
+const VFIConfigurationFile::Data* RobotConstraintEditor::find_data(const std::string& tag) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    const std::size_t index = impl_->store_.find(tag);
+    return index == ConstraintStore::npos ? nullptr : &impl_->store_[index];
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data returns the data with a tag, without copying it.
+ *        The reference is invalidated by any modification of the editor.
+ * @param tag The tag of the data.
+ * @return The desired data.
+ */
+const VFIConfigurationFile::Data& RobotConstraintEditor::get_data(const std::string& tag) const
+{
+    const auto* data = find_data(tag);
+    if (!data)
+        throw std::runtime_error("Tag '" + tag + "' not found!");
+    return *data;
+}
+
+/**
+ * @brief RobotConstraintEditor::visit_data calls a function with each constraint, sorted by tag, without
+ *        copying them. The editor is locked during the visit, so the function must not modify the editor
+ *        or wait for another thread that uses it.
+ * @param visitor The function to call.
+ */
+void RobotConstraintEditor::visit_data(const std::function<void(const VFIConfigurationFile::Data&)>& visitor) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    for (const auto& index : impl_->store_.ordered())
+        visitor(impl_->store_[index]);
+}
+
+/**
+ * @brief RobotConstraintEditor::get_interned_data returns the data sorted by tag, in the compact form
+ *        of an InternedConstraintSet.
+ * @param symbols The SymbolTable used to intern the strings. If it is undefined, the set uses its own table.
+ * @return The desired set.
+ */
+InternedConstraintSet RobotConstraintEditor::get_interned_data(const std::shared_ptr<SymbolTable>& symbols) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    InternedConstraintSet interned_data = symbols ? InternedConstraintSet(symbols) : InternedConstraintSet();
+    interned_data.reserve(impl_->store_.size());
+    for (const auto& index : impl_->store_.ordered())
+        interned_data.add_data(impl_->store_[index]);
+    return interned_data;
+}
+
+/**
+ * @brief RobotConstraintEditor::get_columns returns a columnar snapshot of the data, sorted by tag, for
+ *        bulk numeric queries. The snapshot does not change when the editor is modified.
+ * @return The desired table.
+ */
+ConstraintColumns RobotConstraintEditor::get_columns() const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    ConstraintColumns columns;
+    columns.reserve(impl_->store_.size());
+    for (const auto& index : impl_->store_.ordered())
+        columns.add_data(impl_->store_[index]);
+    return columns;
+}
+
+/**
+ * @brief RobotConstraintEditor::validate_data checks the numeric fields of the data
+ *        (see ConstraintValidation::validate()).
+ * @param zero_indexed True if the robot and joint indexes start at zero. False if they start at one.
+ * @return The report, with the violations sorted by tag.
+ */
+ConstraintValidation::Report RobotConstraintEditor::validate_data(const bool& zero_indexed) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    const auto& ordered = impl_->store_.ordered();
+    return ConstraintValidation::validate(ordered.size(), [&](const std::size_t& i) -> const VFIConfigurationFile::Data& {
+        return impl_->store_[ordered[i]];
+    }, zero_indexed);
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_by_robot returns the constraints that involve a robot, as
+ *        robot_index, robot_index_one or robot_index_two. The view is not sorted, and it is invalidated
+ *        by any modification of the editor.
+ * @param robot_index The robot index.
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_by_robot(const int& robot_index) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_view(impl_->indices_.find_robot(robot_index));
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_by_joint returns the constraints that involve a joint of a robot,
+ *        in any of their (robot, joint) pairs. The view is not sorted, and it is invalidated by any modification
+ *        of the editor.
+ * @param robot_index The robot index.
+ * @param joint_index The joint index.
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_by_joint(const int& robot_index, const int& joint_index) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_view(impl_->indices_.find_joint(robot_index, joint_index));
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_by_vfi_type returns the constraints with a vfi_type. The view is
+ *        not sorted, and it is invalidated by any modification of the editor.
+ * @param vfi_type The vfi_type (e.g. "ENVIRONMENT_TO_ROBOT").
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_by_vfi_type(const std::string& vfi_type) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_view(impl_->indices_.find_vfi_type(vfi_type));
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_by_direction returns the constraints with a direction. The view
+ *        is not sorted, and it is invalidated by any modification of the editor.
+ * @param direction The direction (e.g. "RESTRICTED_ZONE").
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_by_direction(const std::string& direction) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_view(impl_->indices_.find_direction(direction));
+}
+
+/**
+ * @brief RobotConstraintEditor::get_data_by_entity returns the constraints with an entity name in any of
+ *        their cs_entity lists. The view is not sorted, and it is invalidated by any modification of the editor.
+ * @param entity The entity name.
+ * @return The desired view.
+ */
+ConstraintView RobotConstraintEditor::get_data_by_entity(const std::string& entity) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->_view(impl_->indices_.find_entity(entity));
+}
+
+/**
+ * @brief RobotConstraintEditor::rename_entity replaces an entity name in the cs_entity lists of all the
+ *        constraints. Only the constraints that have the name are visited, using the entity index.
+ * @param old_entity The current entity name.
+ * @param new_entity The new entity name.
+ * @return The number of modified constraints.
+ */
+std::size_t RobotConstraintEditor::rename_entity(const std::string& old_entity, const std::string& new_entity)
+{
+    if (old_entity == new_entity)
+        return 0;
+    Impl::EditScope scope(*impl_);
+    const auto* found = impl_->indices_.find_entity(old_entity);
+    if (!found)
+        return 0;
+    // The list is modified by the index updates
+    const std::vector<std::uint32_t> indexes = *found;
+    for (const auto& index : indexes)
+    {
+        auto previous = impl_->_previous(index);
+        std::visit([&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                Impl::_rename_entity(arg.cs_entity_environment, old_entity, new_entity);
+                Impl::_rename_entity(arg.cs_entity_robot, old_entity, new_entity);
+            } else {
+                Impl::_rename_entity(arg.cs_entity_one, old_entity, new_entity);
+                Impl::_rename_entity(arg.cs_entity_two, old_entity, new_entity);
+            }
+        }, impl_->store_[index]);
+        impl_->_update(index, true, std::move(previous));
+    }
+    return indexes.size();
+}
+
+/**
+ * @brief RobotConstraintEditor::has_tag checks if a tag is being used.
+ * @param tag The tag to check.
+ * @return True if there is data with the tag. False otherwise.
+ */
+bool RobotConstraintEditor::has_tag(const std::string& tag) const
+{
+    const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    return impl_->is_tag_in_map(tag);
+}
+
+/**
+ * @brief RobotConstraintEditor::get_snapshot returns an immutable version of the data, which can be read
+ *        from any thread while the editor is modified. The editor is thread-safe: every method locks it,
+ *        including the ones that return views, references or pointers (e.g. get_data_view(), find_data() or
+ *        get_data_by_robot()), so they can all be called while another thread modifies the editor. What they
+ *        return, however, points into the editor: it is only valid until the next modification, so it can
+ *        only be used while no other thread modifies the editor. Read a snapshot instead.
+ *        The writers publish a snapshot at the end of each modification, which copies only the chunks of
+ *        constraints that changed (see ConstraintSnapshot). This method returns the published snapshot
+ *        without locking the editor, so it never waits for a writer. The writers start publishing at the
+ *        first call, which builds the first snapshot.
+ * @return The snapshot.
+ */
+ConstraintSnapshot RobotConstraintEditor::get_snapshot() const
+{
+    if (!impl_->is_publishing_.load(std::memory_order_acquire))
+    {
+        // The editors that are never read through snapshots do not copy their data
+        const std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+        if (!impl_->is_publishing_.load(std::memory_order_relaxed))
+        {
+            impl_->_publish();
+            impl_->is_publishing_.store(true, std::memory_order_release);
+        }
+    }
+    return *std::atomic_load(&impl_->published_);
 }
 
 }
@@ -0,0 +1,114 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/symbol_table.hpp>
+#include <deque>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace DQ_robotics_extensions
+{
+
+class SymbolTable::Impl
+{
+public:
+    std::deque<std::string> strings_; // A deque does not move the strings when it grows
+    std::unordered_map<std::string_view, Id> ids_; // The keys point to strings_
+
+    Impl()
+    {
+
+    };
+};
+
+/**
+ * @brief SymbolTable::SymbolTable ctor of the class.
+ */
+SymbolTable::SymbolTable()
+{
+    impl_ = std::make_shared<SymbolTable::Impl>();
+}
+
+/**
+ * @brief SymbolTable::intern adds a string to the table, if it is not there yet.
+ * @param value The string.
+ * @return The Id of the string.
+ */
+SymbolTable::Id SymbolTable::intern(const std::string_view& value)
+{
+    const auto it = impl_->ids_.find(value);
+    if (it != impl_->ids_.end())
+        return it->second;
+    if (impl_->strings_.size() == npos)
+        throw std::runtime_error("SymbolTable::intern: The table is full!");
+    const Id id = static_cast<Id>(impl_->strings_.size());
+    impl_->ids_.emplace(impl_->strings_.emplace_back(value), id);
+    return id;
+}
+
+/**
+ * @brief SymbolTable::find gets the Id of a string, without adding it.
+ * @param value The string.
+ * @return The Id of the string, or SymbolTable::npos if the string is not in the table.
+ */
+SymbolTable::Id SymbolTable::find(const std::string_view& value) const
+{
+    const auto it = impl_->ids_.find(value);
+    return it != impl_->ids_.end() ? it->second : npos;
+}
+
+/**
+ * @brief SymbolTable::get gets the string of an Id.
+ * @param id The Id returned by intern().
+ * @return The desired string.
+ */
+const std::string& SymbolTable::get(const Id& id) const
+{
+    if (id >= impl_->strings_.size())
+        throw std::runtime_error("SymbolTable::get: Unknown symbol id " + std::to_string(id) + "!");
+    return impl_->strings_[id];
+}
+
+/**
+ * @brief SymbolTable::size returns the number of distinct strings.
+ */
+std::size_t SymbolTable::size() const
+{
+    return impl_->strings_.size();
+}
+
+/**
+ * @brief SymbolTable::memory_usage estimates the heap memory used by the table, in bytes.
+ */
+std::size_t SymbolTable::memory_usage() const
+{
+    std::size_t bytes = impl_->strings_.size()*sizeof(std::string) +
+                        impl_->ids_.bucket_count()*sizeof(void*) +
+                        impl_->ids_.size()*(sizeof(std::pair<const std::string_view, Id>) + 2*sizeof(void*));
+    for (const auto& value : impl_->strings_)
+        if (value.capacity() > std::string().capacity())
+            bytes += value.capacity() + 1;
+    return bytes;
+}
+
+}
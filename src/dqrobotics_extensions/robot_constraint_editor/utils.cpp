@@ -1,4 +1,5 @@
 #include <dqrobotics_extensions/robot_constraint_editor/utils.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_data_fields.hpp>
 #include <iomanip>
 #include <iostream>
 
@@ -50,54 +51,21 @@ void VFIConfigurationFileData::show_data(const std::vector<VFIConfigurationFile:
     for (size_t i = 0; i < data.size(); ++i) {
         std::cout << "\n\n[" << i + 1 << "/" << data.size() << "] ";
 
-        if (std::holds_alternative<DQ_robotics_extensions::VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(data[i])) {
-            std::cout << "ENVIRONMENT_TO_ROBOT" << std::endl;
+        std::visit([](const auto& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            std::cout << VFIDataFields::Table<T>::name << std::endl;
             std::cout << std::string(50, '-') << std::endl;
 
-            auto& env_data = std::get<DQ_robotics_extensions::VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>(data[i]);
-
-            std::cout << std::left << std::setw(35) << "  vfi_type:" << env_data.vfi_type << std::endl;
-            std::cout << std::setw(35) << "  cs_entity_environment:"
-                      << "[" << join_vector(env_data.cs_entity_environment) << "]" << std::endl;
-            std::cout << std::setw(35) << "  cs_entity_robot:"
-                      << "[" << join_vector(env_data.cs_entity_robot) << "]" << std::endl;
-            std::cout << std::setw(35) << "  entity_environment_primitive_type:"
-                      << env_data.entity_environment_primitive_type << std::endl;
-            std::cout << std::setw(35) << "  entity_robot_primitive_type:"
-                      << env_data.entity_robot_primitive_type << std::endl;
-            std::cout << std::setw(35) << "  robot_index:" << env_data.robot_index << std::endl;
-            std::cout << std::setw(35) << "  joint_index:" << env_data.joint_index << std::endl;
-            std::cout << std::setw(35) << "  safe_distance:" << env_data.safe_distance << std::endl;
-            std::cout << std::setw(35) << "  buffer:" << env_data.buffer << std::endl;
-            std::cout << std::setw(35) << "  vfi_gain:" << env_data.vfi_gain << std::endl;
-            std::cout << std::setw(35) << "  direction:" << env_data.direction << std::endl;
-            std::cout << std::setw(35) << "  tag:" << env_data.tag << std::endl;
-
-        } else {
-            std::cout << "ROBOT_TO_ROBOT" << std::endl;
-            std::cout << std::string(50, '-') << std::endl;
-
-            auto& robot_data = std::get<DQ_robotics_extensions::VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>(data[i]);
-
-            std::cout << std::left << std::setw(35) << "  vfi_type:" << robot_data.vfi_type << std::endl;
-            std::cout << std::setw(35) << "  cs_entity_one:"
-                      << "[" << join_vector(robot_data.cs_entity_one) << "]" << std::endl;
-            std::cout << std::setw(35) << "  cs_entity_two:"
-                      << "[" << join_vector(robot_data.cs_entity_two) << "]" << std::endl;
-            std::cout << std::setw(35) << "  entity_one_primitive_type:"
-                      << robot_data.entity_one_primitive_type << std::endl;
-            std::cout << std::setw(35) << "  entity_two_primitive_type:"
-                      << robot_data.entity_two_primitive_type << std::endl;
-            std::cout << std::setw(35) << "  robot_index_one:" << robot_data.robot_index_one << std::endl;
-            std::cout << std::setw(35) << "  robot_index_two:" << robot_data.robot_index_two << std::endl;
-            std::cout << std::setw(35) << "  joint_index_one:" << robot_data.joint_index_one << std::endl;
-            std::cout << std::setw(35) << "  joint_index_two:" << robot_data.joint_index_two << std::endl;
-            std::cout << std::setw(35) << "  safe_distance:" << robot_data.safe_distance << std::endl;
-            std::cout << std::setw(35) << "  buffer:" << robot_data.buffer << std::endl;
-            std::cout << std::setw(35) << "  vfi_gain:" << robot_data.vfi_gain << std::endl;
-            std::cout << std::setw(35) << "  direction:" << robot_data.direction << std::endl;
-            std::cout << std::setw(35) << "  tag:" << robot_data.tag << std::endl;
-        }
+            std::cout << std::left;
+            VFIDataFields::for_each<T>([&](const auto& field, auto) {
+                const auto& value = arg.*field.member;
+                std::cout << std::setw(35) << std::string("  ").append(field.name).append(":");
+                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::vector<std::string>>)
+                    std::cout << "[" << join_vector(value) << "]" << std::endl;
+                else
+                    std::cout << value << std::endl;
+            });
+        }, data[i]);
     }
     std::cout << "\n==========================================" << std::endl;
     std::cout << "END OF LOG" << std::endl;
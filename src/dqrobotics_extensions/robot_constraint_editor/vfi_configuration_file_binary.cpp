@@ -0,0 +1,491 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_binary_format.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
+namespace DQ_robotics_extensions
+{
+
+namespace VFIBinaryFormat
+{
+
+/**
+ * @brief _check_section checks that an array of count elements of element_size bytes starting at offset
+ *        is inside the file and aligned to 8 bytes.
+ */
+static void _check_section(const std::uint64_t& offset, const std::uint64_t& count,
+                           const std::size_t& element_size, const std::size_t& size,
+                           const std::string& section_name)
+{
+    if (offset % 8 != 0 || offset > size || count > (size - offset)/element_size)
+        throw std::runtime_error("Invalid binary constraint file: the " + section_name + " section is out of bounds!");
+}
+
+const Header& validate(const char* data, const std::size_t& size)
+{
+    if (size < sizeof(Header) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("Invalid binary constraint file: wrong file signature!");
+
+    const Header& header = *reinterpret_cast<const Header*>(data);
+    if (header.byte_order != BYTE_ORDER_MARK)
+        throw std::runtime_error("Invalid binary constraint file: the file was written with a different byte order!");
+    if (header.format_version != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported binary constraint file format version: " +
+                                 std::to_string(header.format_version));
+    if (header.file_size != size)
+        throw std::runtime_error("Invalid binary constraint file: the file is truncated!");
+
+    _check_section(header.string_slices_offset, header.string_count, sizeof(StringSlice), size, "string table");
+    _check_section(header.string_bytes_offset, header.string_bytes_size, 1, size, "string bytes");
+    _check_section(header.entity_ids_offset, header.entity_id_count, sizeof(std::uint32_t), size, "entity");
+    _check_section(header.records_offset, header.record_count, sizeof(Record), size, "record");
+
+    const auto* slices = reinterpret_cast<const StringSlice*>(data + header.string_slices_offset);
+    for (std::uint64_t i = 0; i < header.string_count; ++i)
+        if (std::uint64_t(slices[i].offset) + slices[i].size > header.string_bytes_size)
+            throw std::runtime_error("Invalid binary constraint file: string " + std::to_string(i) + " is out of bounds!");
+
+    const auto* entity_ids = reinterpret_cast<const std::uint32_t*>(data + header.entity_ids_offset);
+    for (std::uint64_t i = 0; i < header.entity_id_count; ++i)
+        if (entity_ids[i] >= header.string_count)
+            throw std::runtime_error("Invalid binary constraint file: entity " + std::to_string(i) + " is out of bounds!");
+
+    const auto* records = reinterpret_cast<const Record*>(data + header.records_offset);
+    for (std::uint64_t i = 0; i < header.record_count; ++i)
+    {
+        const Record& record = records[i];
+        bool valid = record.type == RECORD_TYPE::ENVIRONMENT_TO_ROBOT || record.type == RECORD_TYPE::ROBOT_TO_ROBOT;
+        for (const auto& id : {record.vfi_type, record.direction, record.tag,
+                               record.primitive_type_one, record.primitive_type_two})
+            valid = valid && id < header.string_count;
+        valid = valid && std::uint64_t(record.entities_one_offset) + record.entities_one_count <= header.entity_id_count;
+        valid = valid && std::uint64_t(record.entities_two_offset) + record.entities_two_count <= header.entity_id_count;
+        if (!valid)
+            throw std::runtime_error("Invalid binary constraint file: record " + std::to_string(i) + " is corrupted!");
+    }
+    return header;
+}
+
+}
+
+class VFIConfigurationFileBinary::Impl
+{
+public:
+    std::string config_file_;
+    int vfi_file_version_ = 2; // default value
+    bool zero_indexed_ = true; // default value
+    std::vector<Data> raw_data_;
+    FileWriter file_writer_;
+    Impl()
+    {
+
+    };
+
+    /**
+     * @brief _read_file reads the whole configuration file into a buffer aligned to 8 bytes.
+     * @param buffer The buffer to store the file contents.
+     * @return The size of the file in bytes.
+     */
+    std::size_t _read_file(std::vector<std::uint64_t>& buffer)
+    {
+        std::ifstream file(config_file_, std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error("Cannot open file for reading: " + config_file_);
+        const std::size_t size = static_cast<std::size_t>(file.tellg());
+        buffer.resize((size + 7)/8);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size)))
+            throw std::runtime_error("Failed to read the file: " + config_file_);
+        return size;
+    }
+
+    /**
+     * @brief _extract_binary_data reads the binary file and store the data on a RAW_DATA vector.
+     */
+    void _extract_binary_data()
+    {
+        raw_data_.clear();
+        std::vector<std::uint64_t> buffer;
+        const std::size_t size = _read_file(buffer);
+        const char* data = reinterpret_cast<const char*>(buffer.data());
+
+        using namespace VFIBinaryFormat;
+        const Header& header = validate(data, size);
+        vfi_file_version_ = header.vfi_file_version;
+        zero_indexed_ = header.zero_indexed != 0;
+
+        const auto* slices = reinterpret_cast<const StringSlice*>(data + header.string_slices_offset);
+        const char* string_bytes = data + header.string_bytes_offset;
+        const auto* entity_ids = reinterpret_cast<const std::uint32_t*>(data + header.entity_ids_offset);
+        const auto* records = reinterpret_cast<const Record*>(data + header.records_offset);
+
+        auto to_string = [&](const std::uint32_t& id) {
+            return std::string(string_bytes + slices[id].offset, slices[id].size);
+        };
+        auto to_list = [&](const std::uint32_t& offset, const std::uint32_t& count) {
+            std::vector<std::string> list;
+            list.reserve(count);
+            for (std::uint32_t i = 0; i < count; ++i)
+                list.push_back(to_string(entity_ids[offset + i]));
+            return list;
+        };
+
+        raw_data_.reserve(header.record_count);
+        for (std::uint64_t i = 0; i < header.record_count; ++i)
+        {
+            const Record& record = records[i];
+            if (record.type == RECORD_TYPE::ENVIRONMENT_TO_ROBOT)
+            {
+                ENVIRONMENT_TO_ROBOT_DATA env_data;
+                env_data.vfi_type = to_string(record.vfi_type);
+                env_data.cs_entity_environment = to_list(record.entities_one_offset, record.entities_one_count);
+                env_data.cs_entity_robot = to_list(record.entities_two_offset, record.entities_two_count);
+                env_data.entity_environment_primitive_type = to_string(record.primitive_type_one);
+                env_data.entity_robot_primitive_type = to_string(record.primitive_type_two);
+                env_data.robot_index = record.robot_index_one;
+                env_data.joint_index = record.joint_index_one;
+                env_data.safe_distance = record.safe_distance;
+                env_data.buffer = record.buffer;
+                env_data.vfi_gain = record.vfi_gain;
+                env_data.direction = to_string(record.direction);
+                env_data.tag = to_string(record.tag);
+                raw_data_.push_back(std::move(env_data));
+            }
+            else
+            {
+                ROBOT_TO_ROBOT_DATA robot_data;
+                robot_data.vfi_type = to_string(record.vfi_type);
+                robot_data.cs_entity_one = to_list(record.entities_one_offset, record.entities_one_count);
+                robot_data.cs_entity_two = to_list(record.entities_two_offset, record.entities_two_count);
+                robot_data.entity_one_primitive_type = to_string(record.primitive_type_one);
+                robot_data.entity_two_primitive_type = to_string(record.primitive_type_two);
+                robot_data.robot_index_one = record.robot_index_one;
+                robot_data.robot_index_two = record.robot_index_two;
+                robot_data.joint_index_one = record.joint_index_one;
+                robot_data.joint_index_two = record.joint_index_two;
+                robot_data.safe_distance = record.safe_distance;
+                robot_data.buffer = record.buffer;
+                robot_data.vfi_gain = record.vfi_gain;
+                robot_data.direction = to_string(record.direction);
+                robot_data.tag = to_string(record.tag);
+                raw_data_.push_back(std::move(robot_data));
+            }
+        }
+    }
+
+    /**
+     * @brief The StringTable class interns the strings of the constraints being saved.
+     *        The strings are referenced, not copied, so the data must outlive the table.
+     */
+    class StringTable
+    {
+    private:
+        std::unordered_map<std::string_view, std::uint32_t> ids_;
+    public:
+        std::vector<VFIBinaryFormat::StringSlice> slices;
+        std::string bytes;
+
+        std::uint32_t intern(const std::string& value)
+        {
+            auto [it, inserted] = ids_.try_emplace(value, static_cast<std::uint32_t>(slices.size()));
+            if (inserted)
+            {
+                if (bytes.size() + value.size() > std::numeric_limits<std::uint32_t>::max())
+                    throw std::runtime_error("The strings of the constraints exceed the binary format limit!");
+                slices.push_back({static_cast<std::uint32_t>(bytes.size()), static_cast<std::uint32_t>(value.size())});
+                bytes.append(value);
+            }
+            return it->second;
+        }
+    };
+
+    /**
+     * @brief _write_section writes a section followed by the padding up to the next multiple of 8 bytes.
+     */
+    void _write_section(const void* data, const std::size_t& size)
+    {
+        static const char padding[8] = {};
+        file_writer_.write(static_cast<const char*>(data), size);
+        file_writer_.write(padding, VFIBinaryFormat::align(size) - size);
+    }
+
+    void _write_binary_data(const std::vector<Data>& data,
+                            const int& vfi_file_version,
+                            const bool& zero_indexed,
+                            const std::string& config_file)
+    {
+        using namespace VFIBinaryFormat;
+        StringTable strings;
+        std::vector<std::uint32_t> entity_ids;
+        std::vector<Record> records;
+        records.reserve(data.size());
+
+        auto intern_list = [&](const std::vector<std::string>& list, std::uint32_t& offset, std::uint32_t& count) {
+            if (entity_ids.size() + list.size() > std::numeric_limits<std::uint32_t>::max())
+                throw std::runtime_error("The entity lists exceed the binary format limit!");
+            offset = static_cast<std::uint32_t>(entity_ids.size());
+            count = static_cast<std::uint32_t>(list.size());
+            for (const auto& entity : list)
+                entity_ids.push_back(strings.intern(entity));
+        };
+
+        for (const auto& item : data)
+        {
+            Record record{};
+            std::visit([&](auto&& arg) {
+                using T = std::decay_t<decltype(arg)>;
+                record.safe_distance = arg.safe_distance;
+                record.buffer = arg.buffer;
+                record.vfi_gain = arg.vfi_gain;
+                record.vfi_type = strings.intern(arg.vfi_type);
+                record.direction = strings.intern(arg.direction);
+                record.tag = strings.intern(arg.tag);
+
+                if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
+                    record.type = RECORD_TYPE::ENVIRONMENT_TO_ROBOT;
+                    record.primitive_type_one = strings.intern(arg.entity_environment_primitive_type);
+                    record.primitive_type_two = strings.intern(arg.entity_robot_primitive_type);
+                    intern_list(arg.cs_entity_environment, record.entities_one_offset, record.entities_one_count);
+                    intern_list(arg.cs_entity_robot, record.entities_two_offset, record.entities_two_count);
+                    record.robot_index_one = arg.robot_index;
+                    record.joint_index_one = arg.joint_index;
+                } else if constexpr (std::is_same_v<T, VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>) {
+                    record.type = RECORD_TYPE::ROBOT_TO_ROBOT;
+                    record.primitive_type_one = strings.intern(arg.entity_one_primitive_type);
+                    record.primitive_type_two = strings.intern(arg.entity_two_primitive_type);
+                    intern_list(arg.cs_entity_one, record.entities_one_offset, record.entities_one_count);
+                    intern_list(arg.cs_entity_two, record.entities_two_offset, record.entities_two_count);
+                    record.robot_index_one = arg.robot_index_one;
+                    record.robot_index_two = arg.robot_index_two;
+                    record.joint_index_one = arg.joint_index_one;
+                    record.joint_index_two = arg.joint_index_two;
+                }
+            }, item);
+            records.push_back(record);
+        }
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.format_version = FORMAT_VERSION;
+        header.byte_order = BYTE_ORDER_MARK;
+        header.vfi_file_version = vfi_file_version;
+        header.zero_indexed = zero_indexed ? 1 : 0;
+        header.string_count = static_cast<std::uint32_t>(strings.slices.size());
+        header.string_slices_offset = align(sizeof(Header));
+        header.string_bytes_offset = align(header.string_slices_offset + strings.slices.size()*sizeof(StringSlice));
+        header.string_bytes_size = strings.bytes.size();
+        header.entity_ids_offset = align(header.string_bytes_offset + strings.bytes.size());
+        header.entity_id_count = entity_ids.size();
+        header.records_offset = align(header.entity_ids_offset + entity_ids.size()*sizeof(std::uint32_t));
+        header.record_count = records.size();
+        header.file_size = header.records_offset + records.size()*sizeof(Record);
+
+        file_writer_.open(config_file);
+        try {
+            _write_section(&header, sizeof(Header));
+            _write_section(strings.slices.data(), strings.slices.size()*sizeof(StringSlice));
+            _write_section(strings.bytes.data(), strings.bytes.size());
+            _write_section(entity_ids.data(), entity_ids.size()*sizeof(std::uint32_t));
+            _write_section(records.data(), records.size()*sizeof(Record));
+        } catch (...) {
+            file_writer_.discard();
+            throw;
+        }
+        file_writer_.commit();
+    }
+};
+
+/**
+ * @brief VFIConfigurationFileBinary::VFIConfigurationFileBinary ctor of the class.
+ */
+VFIConfigurationFileBinary::VFIConfigurationFileBinary()
+{
+    impl_ = std::make_shared<VFIConfigurationFileBinary::Impl>();
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::set_save_mode sets how save_data() replaces the target file.
+ * @param save_mode FileWriter::SAVE_MODE::IN_PLACE (default) or FileWriter::SAVE_MODE::ATOMIC.
+ */
+void VFIConfigurationFileBinary::set_save_mode(const FileWriter::SAVE_MODE& save_mode)
+{
+    if (save_mode == FileWriter::SAVE_MODE::APPEND)
+        throw std::runtime_error("VFIConfigurationFileBinary::set_save_mode: The APPEND mode is not supported!");
+    impl_->file_writer_.set_save_mode(save_mode);
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::get_save_mode gets how save_data() replaces the target file.
+ * @return The current save mode.
+ */
+FileWriter::SAVE_MODE VFIConfigurationFileBinary::get_save_mode() const
+{
+    return impl_->file_writer_.get_save_mode();
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::set_sync_policy sets when the files written by save_data() are
+ *        flushed to the storage device.
+ * @param sync_policy The desired FileWriter::SYNC_POLICY. The default is NO_SYNC; use SYNC_EACH_FILE
+ *        (with FileWriter::SAVE_MODE::ATOMIC) when the saved file must survive a power loss.
+ */
+void VFIConfigurationFileBinary::set_sync_policy(const FileWriter::SYNC_POLICY& sync_policy)
+{
+    impl_->file_writer_.set_sync_policy(sync_policy);
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::get_sync_policy gets when the files written by save_data() are
+ *        flushed to the storage device.
+ * @return The current sync policy.
+ */
+FileWriter::SYNC_POLICY VFIConfigurationFileBinary::get_sync_policy() const
+{
+    return impl_->file_writer_.get_sync_policy();
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::sync_pending_saves flushes the files saved with
+ *        FileWriter::SYNC_POLICY::DEFERRED_SYNC, and their directories once each.
+ */
+void VFIConfigurationFileBinary::sync_pending_saves()
+{
+    impl_->file_writer_.sync_pending();
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::new_instance creates a VFIConfigurationFileBinary with the same settings and no data.
+ * @return The new object.
+ */
+std::shared_ptr<VFIConfigurationFile> VFIConfigurationFileBinary::new_instance() const
+{
+    auto instance = std::make_shared<VFIConfigurationFileBinary>();
+    instance->set_save_mode(get_save_mode());
+    instance->set_sync_policy(get_sync_policy());
+    return instance;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::load_data loads a binary configuration file.
+ * @param config_file The name of the file including its path and format.
+ */
+void VFIConfigurationFileBinary::load_data(const std::string& config_file)
+{
+    impl_->config_file_ = config_file;
+    impl_->_extract_binary_data();
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::get_data gets the raw data vector from a binary file.
+ * @return A raw data vector.
+ */
+std::vector<VFIConfigurationFile::Data> VFIConfigurationFileBinary::get_data() const
+{
+    if (impl_->raw_data_.empty())
+        throw std::runtime_error("The vector data is empty!");
+    return impl_->raw_data_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::take_data moves the data vector out of the object, without copying it.
+ *        The object is left without data. Unlike get_data(), it does not throw if there is no data.
+ * @return The data vector.
+ */
+std::vector<VFIConfigurationFile::Data> VFIConfigurationFileBinary::take_data()
+{
+    std::vector<VFIConfigurationFile::Data> data;
+    data.swap(impl_->raw_data_);
+    return data;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::view_data gives read-only access to the data vector, without copying it.
+ *        Unlike get_data(), it does not throw if there is no data. The reference is invalidated
+ *        by the next call to load_data() or take_data().
+ * @return The data vector.
+ */
+const std::vector<VFIConfigurationFile::Data>& VFIConfigurationFileBinary::view_data() const
+{
+    return impl_->raw_data_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::get_vfi_file_version gets the vfi_file_version stored in the binary file.
+ * @return The desired data.
+ */
+int VFIConfigurationFileBinary::get_vfi_file_version() const
+{
+    return impl_->vfi_file_version_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::is_zero_indexed.
+ * @return Returns true if the configuration file uses a zero-indexed convention to
+ *         describe the joint and robot indexes. False otherwise.
+ */
+bool VFIConfigurationFileBinary::is_zero_indexed() const
+{
+    return impl_->zero_indexed_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinary::save_data saves a binary configuration file containing the VFI constraints.
+ * @param data the vector that contains the VFI configurations
+ * @param vfi_file_version The desired format version
+ * @param zero_indexed To define if the data uses a zero-indexed convention.
+ * @param config_file The desired name of the file including its path and format.
+ */
+void VFIConfigurationFileBinary::save_data(const std::vector<Data>& data,
+                                           const int& vfi_file_version,
+                                           const bool& zero_indexed,
+                                           const std::string& config_file)
+{
+    try {
+        if (config_file.empty())
+            throw std::runtime_error("config_file path cannot be empty!");
+
+        // Create directory if it doesn't exist
+        std::filesystem::path directory = std::filesystem::path(config_file).parent_path();
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            std::cout << "Creating directory: " << directory << std::endl;
+            std::filesystem::create_directories(directory);
+        }
+
+        impl_->_write_binary_data(data, vfi_file_version, zero_indexed, config_file);
+
+    } catch (const std::filesystem::filesystem_error& e) {
+        throw std::runtime_error("Filesystem error in save_data: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Error in save_data: " + std::string(e.what()));
+    }
+}
+
+}
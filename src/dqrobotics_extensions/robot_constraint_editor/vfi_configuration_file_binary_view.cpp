@@ -0,0 +1,171 @@
+/*
+#    Copyright (c) 2024-2026 Adorno-Lab
+#
+#    robot_constraint_editor is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU Lesser General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    robot_constraint_editor is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU Lesser General Public License for more details.
+#
+#    You should have received a copy of the GNU Lesser General Public License
+#    along with robot_constraint_editor.  If not, see <https://www.gnu.org/licenses/>.
+#
+# ################################################################
+#
+#   Author: Juan Jose Quiroz Omana (email: juanjose.quirozomana@manchester.ac.uk)
+#
+# ################################################################
+*/
+
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_configuration_file_binary_view.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace DQ_robotics_extensions
+{
+
+class VFIConfigurationFileBinaryView::Impl
+{
+public:
+    void* mapping_ = MAP_FAILED;
+    std::size_t size_ = 0;
+    int vfi_file_version_ = 2;
+    bool zero_indexed_ = true;
+    Sections sections_;
+
+    /**
+     * @brief Impl maps the file with read-only, shared pages and validates its contents.
+     * @param config_file The name of the file including its path and format.
+     */
+    explicit Impl(const std::string& config_file)
+    {
+        int fd = ::open(config_file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("Cannot open file for reading: " + config_file + " (" + std::strerror(errno) + ")");
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot read the size of the file: " + config_file);
+        }
+        size_ = static_cast<std::size_t>(file_stat.st_size);
+        if (size_ > 0)
+            mapping_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (size_ > 0 && mapping_ == MAP_FAILED)
+            throw std::runtime_error("Cannot map the file: " + config_file + " (" + std::strerror(errno) + ")");
+
+        try {
+            // mmap returns page-aligned memory, which satisfies the alignment of the format
+            const char* data = size_ > 0 ? static_cast<const char*>(mapping_) : "";
+            const VFIBinaryFormat::Header& header = VFIBinaryFormat::validate(data, size_);
+            vfi_file_version_ = header.vfi_file_version;
+            zero_indexed_ = header.zero_indexed != 0;
+            sections_.string_slices = reinterpret_cast<const VFIBinaryFormat::StringSlice*>(data + header.string_slices_offset);
+            sections_.string_bytes = data + header.string_bytes_offset;
+            sections_.entity_ids = reinterpret_cast<const std::uint32_t*>(data + header.entity_ids_offset);
+            sections_.records = reinterpret_cast<const VFIBinaryFormat::Record*>(data + header.records_offset);
+            sections_.record_count = header.record_count;
+        } catch (...) {
+            _unmap();
+            throw;
+        }
+    }
+
+    ~Impl()
+    {
+        _unmap();
+    }
+
+    void _unmap()
+    {
+        if (mapping_ != MAP_FAILED)
+            ::munmap(mapping_, size_);
+        mapping_ = MAP_FAILED;
+    }
+};
+
+/**
+ * @brief VFIConfigurationFileBinaryView::VFIConfigurationFileBinaryView ctor of the class. Maps a binary
+ *        configuration file written by VFIConfigurationFileBinary.
+ * @param config_file The name of the file including its path and format.
+ */
+VFIConfigurationFileBinaryView::VFIConfigurationFileBinaryView(const std::string& config_file)
+{
+    impl_ = std::make_shared<VFIConfigurationFileBinaryView::Impl>(config_file);
+    sections_ = &impl_->sections_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinaryView::get_vfi_file_version gets the vfi_file_version stored in the file.
+ * @return The desired data.
+ */
+int VFIConfigurationFileBinaryView::get_vfi_file_version() const
+{
+    return impl_->vfi_file_version_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinaryView::is_zero_indexed.
+ * @return Returns true if the configuration file uses a zero-indexed convention to
+ *         describe the joint and robot indexes. False otherwise.
+ */
+bool VFIConfigurationFileBinaryView::is_zero_indexed() const
+{
+    return impl_->zero_indexed_;
+}
+
+/**
+ * @brief VFIConfigurationFileBinaryView::Constraint::to_data copies the constraint into a
+ *        VFIConfigurationFile::Data.
+ * @return The desired data.
+ */
+VFIConfigurationFile::Data VFIConfigurationFileBinaryView::Constraint::to_data() const
+{
+    auto to_vector = [](const EntityList& list) {
+        return std::vector<std::string>(list.begin(), list.end());
+    };
+
+    if (is_environment_to_robot())
+    {
+        VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA env_data;
+        env_data.vfi_type = vfi_type();
+        env_data.cs_entity_environment = to_vector(cs_entity_environment());
+        env_data.cs_entity_robot = to_vector(cs_entity_robot());
+        env_data.entity_environment_primitive_type = entity_environment_primitive_type();
+        env_data.entity_robot_primitive_type = entity_robot_primitive_type();
+        env_data.robot_index = robot_index();
+        env_data.joint_index = joint_index();
+        env_data.safe_distance = safe_distance();
+        env_data.buffer = buffer();
+        env_data.vfi_gain = vfi_gain();
+        env_data.direction = direction();
+        env_data.tag = tag();
+        return env_data;
+    }
+    VFIConfigurationFile::ROBOT_TO_ROBOT_DATA robot_data;
+    robot_data.vfi_type = vfi_type();
+    robot_data.cs_entity_one = to_vector(cs_entity_one());
+    robot_data.cs_entity_two = to_vector(cs_entity_two());
+    robot_data.entity_one_primitive_type = entity_one_primitive_type();
+    robot_data.entity_two_primitive_type = entity_two_primitive_type();
+    robot_data.robot_index_one = robot_index_one();
+    robot_data.robot_index_two = robot_index_two();
+    robot_data.joint_index_one = joint_index_one();
+    robot_data.joint_index_two = joint_index_two();
+    robot_data.safe_distance = safe_distance();
+    robot_data.buffer = buffer();
+    robot_data.vfi_gain = vfi_gain();
+    robot_data.direction = direction();
+    robot_data.tag = tag();
+    return robot_data;
+}
+
+}
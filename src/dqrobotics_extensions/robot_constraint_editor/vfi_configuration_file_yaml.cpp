@@ -25,8 +25,19 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <string_view>
+#include <exception>
+#include <functional>
+#include <unordered_map>
 #include <yaml-cpp/yaml.h>
+#include <yaml-cpp/eventhandler.h>
 #include <dqrobotics_extensions/robot_constraint_editor/utils.hpp>
+#include <dqrobotics_extensions/robot_constraint_editor/vfi_data_fields.hpp>
+#include "parallel_for.hpp"
 
 namespace DQ_robotics_extensions
 {
@@ -39,11 +50,607 @@ public:
     int vfi_file_version_ = 2; // default value
     bool zero_indexed_ = true; // default value
     std::vector<Data> raw_data_;
+    std::function<void(Data&)> item_sink_; // Set by load_interned_data() and load_pmr_data() during the load
+    LOAD_MODE load_mode_ = LOAD_MODE::DOM;
+    std::size_t number_of_threads_ = 0; // Used by LOAD_MODE::PARALLEL_DOM. Zero means one thread per core.
+    std::string write_buffer_; // Reused by save_data() to format the file contents
+    FileWriter file_writer_;
+    std::shared_ptr<ParseCache> parse_cache_; // Used by load_data(), if set
     Impl()
     {
 
     };
 
+    /**
+     * @brief _load_into loads a configuration file and passes each item to a sink instead of keeping it
+     *        in raw_data_. In the STREAMING mode, the items are passed while the file is parsed.
+     */
+    void _load_into(const std::function<void(Data&)>& sink, const std::string& config_file)
+    {
+        config_file_ = config_file;
+        if (load_mode_ == LOAD_MODE::STREAMING)
+        {
+            item_sink_ = sink;
+            try {
+                _extract_yaml_data();
+            } catch (...) {
+                item_sink_ = nullptr;
+                throw;
+            }
+            item_sink_ = nullptr;
+        }
+        else
+        {
+            _extract_yaml_data();
+            for (auto& item : raw_data_)
+                sink(item);
+        }
+        raw_data_.clear();
+        config_ = YAML::Node();
+    }
+
+    /**
+     * @brief The YamlWriter class formats a configuration file into a byte buffer and writes it to
+     *        the file in large blocks. Numbers are formatted with std::to_chars, which does not
+     *        depend on the stream locale.
+     */
+    class YamlWriter
+    {
+    private:
+        static constexpr std::size_t block_size_ = 1 << 20;
+        std::string& buffer_;
+        FileWriter& file_;
+
+    public:
+        YamlWriter(std::string& buffer, FileWriter& file)
+            : buffer_(buffer), file_(file)
+        {
+            buffer_.clear();
+            buffer_.reserve(block_size_ + 4096);
+        }
+
+        void flush()
+        {
+            file_.write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+
+        void append(const std::string_view& text)
+        {
+            buffer_.append(text.data(), text.size());
+            if (buffer_.size() >= block_size_)
+                flush();
+        }
+
+        void append_int(const int& value)
+        {
+            char text[16];
+            auto result = std::to_chars(std::begin(text), std::end(text), value);
+            append(std::string_view(text, static_cast<std::size_t>(result.ptr - text)));
+        }
+
+        /**
+         * @brief append_double writes a double in the printf "%g" style used by std::ostream.
+         *        The precision is the larger of 6 (the std::ostream default) and the number of digits
+         *        of the shortest round-trip representation. Values with up to 6 significant digits are
+         *        written exactly as before, and the others are no longer truncated.
+         *        Non-finite values are written as .inf, -.inf and .nan so that the YAML file can be loaded back.
+         * @param value The value to write.
+         * @param decimal_point If true, an integral value is written with a ".0" suffix (e.g. 1.0).
+         */
+        void append_double(const double& value, const bool& decimal_point = false)
+        {
+            if (std::isnan(value)) {
+                append(".nan");
+                return;
+            }
+            if (std::isinf(value)) {
+                append(value > 0 ? ".inf" : "-.inf");
+                return;
+            }
+            char text[64];
+            auto shortest = std::to_chars(std::begin(text), std::end(text), value, std::chars_format::scientific);
+            int digits = 0;
+            for (const char* c = text; c != shortest.ptr && *c != 'e'; ++c)
+                if (*c >= '0' && *c <= '9')
+                    ++digits;
+            auto result = std::to_chars(std::begin(text), std::end(text), value,
+                                        std::chars_format::general, std::max(digits, 6));
+            std::string_view formatted(text, static_cast<std::size_t>(result.ptr - text));
+            append(formatted);
+            if (decimal_point && formatted.find_first_not_of("-0123456789") == std::string_view::npos)
+                append(".0");
+        }
+
+        void append_string(const std::string& value)
+        {
+            append("\"");
+            append(value);
+            append("\"");
+        }
+
+        void append_string_list(const std::vector<std::string>& values)
+        {
+            append("[");
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                if (i > 0)
+                    append(", ");
+                append_string(values[i]);
+            }
+            append("]");
+        }
+
+        void append_key(const std::string_view& key)
+        {
+            append("    ");
+            append(key);
+            append(": ");
+        }
+    };
+
+    /**
+     * @brief The StreamValue struct stores a value captured by the StreamingEventHandler.
+     *        It keeps just enough information to reproduce the conversions (and the errors)
+     *        of the YAML::Node based extraction.
+     */
+    struct StreamValue{
+        enum class KIND{
+            NULL_VALUE,
+            SCALAR,
+            SEQUENCE,
+            MAP
+        };
+        KIND kind = KIND::NULL_VALUE;
+        YAML::Mark mark;
+        std::string scalar;
+        std::vector<std::string> list;
+        std::size_t list_size = 0;
+        bool list_is_valid = true;
+        YAML::Mark invalid_list_element_mark;
+    };
+
+    /**
+     * @brief scalar_to converts a YAML scalar using the same rules as YAML::Node::as<T>().
+     *        Plain decimal numbers are converted with std::from_chars. Any other form
+     *        (hexadecimal, octal, .inf, .nan, etc.) falls back to the yaml-cpp converter.
+     * @param scalar The scalar value.
+     * @param mark The position of the scalar in the file. Used for error messages.
+     * @return The converted value.
+     */
+    template<typename T>
+    static T scalar_to(const std::string& scalar, const YAML::Mark& mark)
+    {
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, double>)
+        {
+            const char* first = scalar.data();
+            const char* last = scalar.data() + scalar.size();
+            const char* digits = (first != last && *first == '-') ? first + 1 : first;
+            bool plain_decimal = digits != last && *digits >= '0' && *digits <= '9';
+            if constexpr (std::is_same_v<T, int>)
+            {
+                // A leading zero means octal for the yaml-cpp converter
+                if (plain_decimal && *digits == '0' && digits + 1 != last)
+                    plain_decimal = false;
+            }
+            if (plain_decimal)
+            {
+                T value;
+                auto [ptr, ec] = std::from_chars(first, last, value);
+                if (ec == std::errc() && ptr == last)
+                    return value;
+            }
+        }
+        T value;
+        if (YAML::convert<T>::decode(YAML::Node(scalar), value))
+            return value;
+        throw YAML::TypedBadConversion<T>(mark);
+    }
+
+    /**
+     * @brief The StreamingEventHandler class converts the YAML events of a configuration file into
+     *        Data entries while the file is parsed. Only the fields of the vfi_array item that is being
+     *        parsed are kept in memory.
+     */
+    class StreamingEventHandler : public YAML::EventHandler
+    {
+    private:
+        enum class STATE{
+            DOCUMENT,
+            TOP_MAP_KEY,
+            TOP_MAP_VALUE,
+            VFI_ARRAY,
+            ITEM_KEY,
+            ITEM_VALUE,
+            ITEM_SEQUENCE,
+            SKIP
+        };
+
+        Impl* impl_;
+        STATE state_ = STATE::DOCUMENT;
+        STATE state_after_skip_ = STATE::DOCUMENT;
+        std::size_t skip_depth_ = 0;
+        bool top_is_scalar_ = false;
+        YAML::Mark top_mark_;
+        std::string key_;
+
+        // The item fields are reused from one item to the next to avoid allocations.
+        std::vector<std::pair<std::string, StreamValue>> item_fields_;
+        std::size_t item_size_ = 0;
+        StreamValue* current_value_ = nullptr;
+        std::unordered_map<YAML::anchor_t, std::string> scalar_anchors_;
+
+        std::exception_ptr item_error_;
+
+        StreamValue* _new_item_value(const std::string& key, const StreamValue::KIND& kind, const YAML::Mark& mark)
+        {
+            if (item_size_ == item_fields_.size())
+                item_fields_.emplace_back();
+            auto& field = item_fields_[item_size_++];
+            field.first = key;
+            field.second.kind = kind;
+            field.second.mark = mark;
+            field.second.scalar.clear();
+            field.second.list_size = 0;
+            field.second.list_is_valid = true;
+            return &field.second;
+        }
+
+        const StreamValue* _find(const char* key) const
+        {
+            for (std::size_t i = 0; i < item_size_; ++i)
+                if (item_fields_[i].first == key)
+                    return &item_fields_[i].second;
+            return nullptr;
+        }
+
+        template<typename T>
+        T _as(const char* key) const
+        {
+            const StreamValue* value = _find(key);
+            if (!value)
+                throw YAML::InvalidNode(key);
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                if (value->kind == StreamValue::KIND::NULL_VALUE)
+                    return "null";
+            }
+            if (value->kind != StreamValue::KIND::SCALAR)
+                throw YAML::TypedBadConversion<T>(value->mark);
+            if constexpr (std::is_same_v<T, std::string>)
+                return value->scalar;
+            else
+                return scalar_to<T>(value->scalar, value->mark);
+        }
+
+        std::vector<std::string> _as_list(const char* key) const
+        {
+            const StreamValue* value = _find(key);
+            if (!value)
+                throw YAML::InvalidNode(key);
+            std::vector<std::string> entities;
+            if (value->kind == StreamValue::KIND::SEQUENCE) {
+                if (!value->list_is_valid)
+                    throw YAML::TypedBadConversion<std::string>(value->invalid_list_element_mark);
+                entities.assign(value->list.begin(), value->list.begin() + value->list_size);
+                if (entities.empty())
+                    throw std::runtime_error(std::string(key) + "is an empty list!");
+            }
+            return entities;
+        }
+
+        double _as_buffer() const
+        {
+            try {
+                return _as<double>("buffer");
+            } catch (...) {
+                // Use the default buffer value defined in the virtual class
+                DQ_robotics_extensions::VFIConfigurationFile::BASE_DATA data;
+                return data.buffer;
+            }
+        }
+
+        /**
+         * @brief _convert_item converts the fields of the current vfi_array item.
+         *        The fields are read in the same order used by Impl::_extract_yaml_data()
+         *        so that both load modes report the same error.
+         */
+        void _convert_item()
+        {
+            std::string vfi_type = _as<std::string>("vfi_type");
+
+            if (vfi_type == "ENVIRONMENT_TO_ROBOT") {
+                _store(_convert_fields<ENVIRONMENT_TO_ROBOT_DATA>(vfi_type));
+            }else if (vfi_type == "ROBOT_TO_ROBOT") {
+                _store(_convert_fields<ROBOT_TO_ROBOT_DATA>(vfi_type));
+            }else {
+                throw std::runtime_error("Unknown VFI type: " + vfi_type);
+            }
+        }
+
+        /**
+         * @brief _store keeps a converted item, or passes it to the sink set by load_interned_data()
+         *        or load_pmr_data() if there is one.
+         */
+        void _store(Data&& data)
+        {
+            if (impl_->item_sink_)
+                impl_->item_sink_(data);
+            else
+                impl_->raw_data_.push_back(std::move(data));
+        }
+
+        template<typename DataType>
+        DataType _convert_fields(const std::string& vfi_type) const
+        {
+            DataType data;
+            VFIDataFields::for_each<DataType>([&](const auto& field, auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                using FieldType = VFIDataFields::field_type<DataType, I>;
+                auto& value = data.*field.member;
+                if constexpr (I == VFIDataFields::find<DataType>("vfi_type"))
+                    value = vfi_type;
+                else if constexpr (I == VFIDataFields::find<DataType>("buffer"))
+                    value = _as_buffer();
+                else if constexpr (std::is_same_v<FieldType, std::vector<std::string>>)
+                    value = _as_list(field.name);
+                else
+                    value = _as<FieldType>(field.name);
+            });
+            return data;
+        }
+
+        /**
+         * @brief _item_error stores the first error found while converting the items. The
+         *        parsing continues so that a syntax error later in the file takes precedence,
+         *        as it does when the whole file is loaded first.
+         */
+        template<typename Exception>
+        void _item_error(const Exception& e)
+        {
+            if (!item_error_)
+                item_error_ = std::make_exception_ptr(e);
+        }
+
+        void _end_item()
+        {
+            if (!item_error_)
+            {
+                try {
+                    _convert_item();
+                } catch (...) {
+                    item_error_ = std::current_exception();
+                }
+            }
+            item_size_ = 0;
+        }
+
+        void _on_top_value(const StreamValue::KIND& kind, const YAML::Mark& mark, const std::string& scalar)
+        {
+            for (auto& top_value : top_values)
+            {
+                if (key_ == top_value.first && !top_value.second) {
+                    top_value.second = std::make_unique<StreamValue>();
+                    top_value.second->kind = kind;
+                    top_value.second->mark = mark;
+                    top_value.second->scalar = scalar;
+                }
+            }
+            state_ = STATE::TOP_MAP_KEY;
+        }
+
+        void _on_scalar_value(const StreamValue::KIND& kind, const YAML::Mark& mark, const std::string& value)
+        {
+            switch (state_) {
+            case STATE::DOCUMENT:
+                top_is_scalar_ = kind == StreamValue::KIND::SCALAR;
+                top_mark_ = mark;
+                break;
+            case STATE::TOP_MAP_KEY:
+                key_ = value;
+                state_ = STATE::TOP_MAP_VALUE;
+                break;
+            case STATE::TOP_MAP_VALUE:
+                _on_top_value(kind, mark, value);
+                break;
+            case STATE::VFI_ARRAY:
+                // The item is not a map
+                if (!item_error_)
+                {
+                    if (kind == StreamValue::KIND::SCALAR)
+                        _item_error(YAML::BadSubscript(mark, "vfi_type"));
+                    else
+                        _item_error(YAML::InvalidNode("vfi_type"));
+                }
+                break;
+            case STATE::ITEM_KEY:
+                key_ = value;
+                state_ = STATE::ITEM_VALUE;
+                break;
+            case STATE::ITEM_VALUE:
+                current_value_ = _new_item_value(key_, kind, mark);
+                current_value_->scalar = value;
+                state_ = STATE::ITEM_KEY;
+                break;
+            case STATE::ITEM_SEQUENCE:
+                if (current_value_->list_size == current_value_->list.size())
+                    current_value_->list.emplace_back();
+                current_value_->list[current_value_->list_size++] =
+                    kind == StreamValue::KIND::SCALAR ? value : std::string("null");
+                break;
+            case STATE::SKIP:
+                break;
+            }
+        }
+
+        void _on_collection_start(const StreamValue::KIND& kind, const YAML::Mark& mark)
+        {
+            switch (state_) {
+            case STATE::DOCUMENT:
+                if (kind == StreamValue::KIND::MAP)
+                    state_ = STATE::TOP_MAP_KEY;
+                else
+                    _skip(STATE::DOCUMENT);
+                break;
+            case STATE::TOP_MAP_KEY:
+                // Non-scalar keys are ignored together with their values
+                key_.clear();
+                _skip(STATE::TOP_MAP_VALUE);
+                break;
+            case STATE::TOP_MAP_VALUE:
+                if (key_ == "vfi_array" && !vfi_array_found_)
+                {
+                    vfi_array_found_ = true;
+                    if (kind == StreamValue::KIND::SEQUENCE) {
+                        state_ = STATE::VFI_ARRAY;
+                        break;
+                    }
+                    _item_error(YAML::InvalidNode(std::string()));
+                }
+                _on_top_value(kind, mark, std::string());
+                _skip(STATE::TOP_MAP_KEY);
+                break;
+            case STATE::VFI_ARRAY:
+                if (kind == StreamValue::KIND::MAP) {
+                    item_size_ = 0;
+                    state_ = STATE::ITEM_KEY;
+                } else {
+                    _item_error(YAML::InvalidNode("vfi_type"));
+                    _skip(STATE::VFI_ARRAY);
+                }
+                break;
+            case STATE::ITEM_KEY:
+                key_.clear();
+                _skip(STATE::ITEM_VALUE);
+                break;
+            case STATE::ITEM_VALUE:
+                current_value_ = _new_item_value(key_, kind, mark);
+                if (kind == StreamValue::KIND::SEQUENCE)
+                    state_ = STATE::ITEM_SEQUENCE;
+                else
+                    _skip(STATE::ITEM_KEY);
+                break;
+            case STATE::ITEM_SEQUENCE:
+                // Nested collections cannot be converted to a string
+                if (current_value_->list_is_valid) {
+                    current_value_->list_is_valid = false;
+                    current_value_->invalid_list_element_mark = mark;
+                }
+                _skip(STATE::ITEM_SEQUENCE);
+                break;
+            case STATE::SKIP:
+                ++skip_depth_;
+                break;
+            }
+        }
+
+        void _on_collection_end()
+        {
+            switch (state_) {
+            case STATE::SKIP:
+                if (--skip_depth_ == 0)
+                    state_ = state_after_skip_;
+                break;
+            case STATE::TOP_MAP_KEY:
+                state_ = STATE::DOCUMENT;
+                break;
+            case STATE::VFI_ARRAY:
+                state_ = STATE::TOP_MAP_KEY;
+                break;
+            case STATE::ITEM_KEY:
+                _end_item();
+                state_ = STATE::VFI_ARRAY;
+                break;
+            case STATE::ITEM_SEQUENCE:
+                state_ = STATE::ITEM_KEY;
+                break;
+            default:
+                break;
+            }
+        }
+
+        void _skip(const STATE& state_after_skip)
+        {
+            state_after_skip_ = state_after_skip;
+            skip_depth_ = 1;
+            state_ = STATE::SKIP;
+        }
+
+    public:
+        bool vfi_array_found_ = false;
+        // The vfi_file_version and zero_indexed values, converted after parsing.
+        std::array<std::pair<std::string, std::unique_ptr<StreamValue>>, 2> top_values{{
+            {"vfi_file_version", nullptr},
+            {"zero_indexed", nullptr}
+        }};
+
+        explicit StreamingEventHandler(Impl* impl)
+            : impl_(impl)
+        {
+        }
+
+        bool is_top_scalar() const
+        {
+            return top_is_scalar_;
+        }
+
+        const YAML::Mark& top_mark() const
+        {
+            return top_mark_;
+        }
+
+        const std::exception_ptr& item_error() const
+        {
+            return item_error_;
+        }
+
+        void OnDocumentStart(const YAML::Mark&) override {}
+        void OnDocumentEnd() override {}
+
+        void OnNull(const YAML::Mark& mark, YAML::anchor_t) override
+        {
+            _on_scalar_value(StreamValue::KIND::NULL_VALUE, mark, std::string());
+        }
+
+        void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override
+        {
+            auto it = scalar_anchors_.find(anchor);
+            if (it == scalar_anchors_.end())
+                throw std::runtime_error("Aliases to YAML collections are not supported in the STREAMING load mode. "
+                                         "Line: " + std::to_string(mark.line + 1));
+            _on_scalar_value(StreamValue::KIND::SCALAR, mark, it->second);
+        }
+
+        void OnScalar(const YAML::Mark& mark, const std::string&,
+                      YAML::anchor_t anchor, const std::string& value) override
+        {
+            if (anchor != YAML::NullAnchor)
+                scalar_anchors_[anchor] = value;
+            _on_scalar_value(StreamValue::KIND::SCALAR, mark, value);
+        }
+
+        void OnSequenceStart(const YAML::Mark& mark, const std::string&,
+                             YAML::anchor_t, YAML::EmitterStyle::value) override
+        {
+            _on_collection_start(StreamValue::KIND::SEQUENCE, mark);
+        }
+
+        void OnSequenceEnd() override
+        {
+            _on_collection_end();
+        }
+
+        void OnMapStart(const YAML::Mark& mark, const std::string&,
+                        YAML::anchor_t, YAML::EmitterStyle::value) override
+        {
+            _on_collection_start(StreamValue::KIND::MAP, mark);
+        }
+
+        void OnMapEnd() override
+        {
+            _on_collection_end();
+        }
+    };
+
 
 
     /**
@@ -52,7 +659,7 @@ public:
      * @param key_name The key name to display an error message.
      * @return The desired string vector.
      */
-    std::vector<std::string> get_vector_list(const YAML::Node& node, const std::string& key_name)
+    std::vector<std::string> get_vector_list(const YAML::Node& node, const std::string& key_name) const
     {
         std::vector<std::string> entities;
         if (node.IsSequence()) {
@@ -64,9 +671,184 @@ public:
     }
 
     /**
-     * @brief VFIConfigurationFileYaml::_extract_yaml_data reads the YAML file and store the data on a RAW_DATA vector.
+     * @brief _convert_node reads the fields of a vfi_array item, in the order of VFIDataFields::Table.
+     * @param parameter The vfi_array item.
+     * @param vfi_type The type of the item, which was already read.
+     * @return The desired data.
+     */
+    template<typename DataType>
+    DataType _convert_node(const YAML::Node& parameter, const std::string& vfi_type) const
+    {
+        DataType data;
+        VFIDataFields::for_each<DataType>([&](const auto& field, auto index) {
+            constexpr std::size_t I = decltype(index)::value;
+            using FieldType = VFIDataFields::field_type<DataType, I>;
+            auto& value = data.*field.member;
+            if constexpr (I == VFIDataFields::find<DataType>("vfi_type")) {
+                value = vfi_type;
+            } else if constexpr (I == VFIDataFields::find<DataType>("buffer")) {
+                try {
+                    value = parameter[field.name].template as<double>();
+                } catch (...) {
+                    // Keep the default buffer value defined in the virtual class
+                }
+            } else if constexpr (std::is_same_v<FieldType, std::vector<std::string>>) {
+                value = get_vector_list(parameter[field.name], field.name);
+            } else {
+                value = parameter[field.name].template as<FieldType>();
+            }
+        });
+        return data;
+    }
+
+    /**
+     * @brief _convert_item converts a vfi_array item.
+     * @param parameter The vfi_array item.
+     * @return The desired data.
+     */
+    Data _convert_item(const YAML::Node& parameter) const
+    {
+        std::string vfi_type = parameter["vfi_type"].as<std::string>();
+
+        if (vfi_type == "ENVIRONMENT_TO_ROBOT") {
+            return _convert_node<ENVIRONMENT_TO_ROBOT_DATA>(parameter, vfi_type);
+        }else if (vfi_type == "ROBOT_TO_ROBOT") {
+            return _convert_node<ROBOT_TO_ROBOT_DATA>(parameter, vfi_type);
+        }else {
+            throw std::runtime_error("Unknown VFI type: " + vfi_type);
+        }
+    }
+
+    /**
+     * @brief The ItemError struct carries a YAML::Exception out of a worker thread of _convert_items_parallel().
+     */
+    struct ItemError{
+        std::string msg;
+        std::string what;
+    };
+
+    /**
+     * @brief _convert_items_parallel converts the items of the vfi_array in contiguous chunks, on
+     *        number_of_threads_ threads. The data keeps the order of the file. If several items are
+     *        invalid, the error of the first one is reported, as in the serial loop.
+     * @param vfi_array The vfi_array node.
+     */
+    void _convert_items_parallel(const YAML::Node& vfi_array)
+    {
+        std::vector<YAML::Node> items;
+        for (const auto& parameter : vfi_array)
+            items.push_back(parameter);
+
+        // A few chunks per thread balance the load without making the chunks too small
+        const std::size_t threads = resolve_number_of_threads(number_of_threads_, items.size());
+        const std::size_t chunk_size = std::max<std::size_t>((items.size() + 4*threads - 1)/(4*threads), 64);
+        const std::size_t number_of_chunks = (items.size() + chunk_size - 1)/chunk_size;
+
+        raw_data_.resize(items.size());
+        try {
+            parallel_for(number_of_chunks, threads, [&](const std::size_t& chunk) {
+                const std::size_t end = std::min(items.size(), (chunk + 1)*chunk_size);
+                for (std::size_t i = chunk*chunk_size; i < end; ++i) {
+                    try {
+                        raw_data_[i] = _convert_item(items[i]);
+                    }
+                    catch (const YAML::Exception& e) {
+                        throw ItemError{e.msg, e.what()};
+                    }
+                }
+            });
+        }
+        catch (const ItemError& e) {
+            raw_data_.clear();
+            std::cerr << "Error parsing VFI item: " << e.what << std::endl;
+            throw std::runtime_error(e.msg);
+        }
+        catch (...) {
+            raw_data_.clear();
+            throw;
+        }
+    }
+
+    /**
+     * @brief _extract_yaml_data reads the YAML file and store the data on a RAW_DATA vector.
      */
     void _extract_yaml_data()
+    {
+        if (load_mode_ == LOAD_MODE::STREAMING)
+            _extract_yaml_data_streaming();
+        else
+            _extract_yaml_data_dom();
+    }
+
+    /**
+     * @brief _extract_yaml_data_streaming reads the YAML file with a YAML::Parser and converts each
+     *        vfi_array item as soon as it is parsed. The YAML::Node tree is never built.
+     *        The errors are the same as the ones reported by _extract_yaml_data_dom().
+     */
+    void _extract_yaml_data_streaming()
+    {
+        raw_data_.clear();
+        config_ = YAML::Node();
+        try {
+            std::ifstream file(config_file_);
+            if (!file)
+                throw YAML::BadFile(config_file_);
+
+            StreamingEventHandler handler(this);
+            YAML::Parser parser(file);
+            parser.HandleNextDocument(handler);
+
+            if (handler.is_top_scalar())
+                throw YAML::BadSubscript(handler.top_mark(), "vfi_file_version");
+
+            const auto& version = handler.top_values.at(0).second;
+            if (version)
+                vfi_file_version_ = _top_value_to<int>(*version);
+            else
+                std::cerr << "Warning: vfi_file_version not found, using default: "
+                          << vfi_file_version_ << std::endl;
+
+            const auto& zero_indexed = handler.top_values.at(1).second;
+            if (zero_indexed)
+                zero_indexed_ = _top_value_to<bool>(*zero_indexed);
+            else
+                std::cerr << "Warning: zero_indexed not found, using default: " + bool2string(zero_indexed_)<< std::endl;
+
+            if (handler.item_error())
+            {
+                try {
+                    std::rethrow_exception(handler.item_error());
+                }
+                catch (const YAML::Exception& e) {
+                    std::cerr << "Error parsing VFI item: " << e.what() << std::endl;
+                    throw std::runtime_error(e.msg);
+                }
+            }
+        }
+        catch(const YAML::BadFile& e)
+        {
+            std::cerr << e.msg << std::endl;
+            throw std::runtime_error(e.msg);
+        }
+        catch(const YAML::ParserException& e)
+        {
+            std::cerr << e.msg << std::endl;
+            throw std::runtime_error(e.msg);
+        }
+    }
+
+    template<typename T>
+    static T _top_value_to(const StreamValue& value)
+    {
+        if (value.kind != StreamValue::KIND::SCALAR)
+            throw YAML::TypedBadConversion<T>(value.mark);
+        return scalar_to<T>(value.scalar, value.mark);
+    }
+
+    /**
+     * @brief _extract_yaml_data_dom loads the whole YAML file as a YAML::Node and store the data on a RAW_DATA vector.
+     */
+    void _extract_yaml_data_dom()
     {
         raw_data_.clear();
         try {
@@ -90,68 +872,17 @@ public:
 
 
 
-            for (const auto& parameter : vfi_array) {
-                try {
-                    std::string vfi_type = parameter["vfi_type"].as<std::string>();
-
-                    if (vfi_type == "ENVIRONMENT_TO_ROBOT") {
-                        ENVIRONMENT_TO_ROBOT_DATA env_data;
-                        env_data.vfi_type = vfi_type;
-                        env_data.cs_entity_environment  = get_vector_list(parameter["cs_entity_environment"],
-                                                                                "cs_entity_environment");
-                        env_data.cs_entity_robot  = get_vector_list(parameter["cs_entity_robot"],
-                                                                          "cs_entity_robot");
-                        env_data.entity_environment_primitive_type = parameter["entity_environment_primitive_type"].as<std::string>();
-                        env_data.entity_robot_primitive_type = parameter["entity_robot_primitive_type"].as<std::string>();
-                        env_data.robot_index = parameter["robot_index"].as<int>();
-                        env_data.joint_index = parameter["joint_index"].as<int>();
-                        env_data.safe_distance = parameter["safe_distance"].as<double>();
-                        try {
-                            env_data.buffer = parameter["buffer"].as<double>();
-                        } catch (...) {
-                            // Use the default buffer value defined in the virtual class
-                            DQ_robotics_extensions::VFIConfigurationFile::BASE_DATA data;
-                            env_data.buffer = data.buffer;
-                        }
-
-                        env_data.vfi_gain = parameter["vfi_gain"].as<double>();
-                        env_data.direction = parameter["direction"].as<std::string>();
-                        env_data.tag = parameter["tag"].as<std::string>();
-                        raw_data_.push_back(env_data);
-
-                    }else if (vfi_type == "ROBOT_TO_ROBOT") {
-                        ROBOT_TO_ROBOT_DATA robot_data;
-                        robot_data.vfi_type = vfi_type;
-                        robot_data.cs_entity_one  = get_vector_list(parameter["cs_entity_one"],
-                                                                          "cs_entity_one");
-                        robot_data.cs_entity_two = get_vector_list(parameter["cs_entity_two"],
-                                                                          "cs_entity_two");
-                        robot_data.entity_one_primitive_type = parameter["entity_one_primitive_type"].as<std::string>();
-                        robot_data.entity_two_primitive_type = parameter["entity_two_primitive_type"].as<std::string>();
-                        robot_data.robot_index_one = parameter["robot_index_one"].as<int>();
-                        robot_data.robot_index_two = parameter["robot_index_two"].as<int>();
-                        robot_data.joint_index_one = parameter["joint_index_one"].as<int>();
-                        robot_data.joint_index_two = parameter["joint_index_two"].as<int>();
-                        robot_data.safe_distance = parameter["safe_distance"].as<double>();
-                        try {
-                            robot_data.buffer = parameter["buffer"].as<double>();
-                        } catch (...) {
-                            // Use the default buffer value defined in the virtual class
-                            DQ_robotics_extensions::VFIConfigurationFile::BASE_DATA data;
-                            robot_data.buffer = data.buffer;
-                        }
-                        robot_data.vfi_gain = parameter["vfi_gain"].as<double>();
-                        robot_data.direction = parameter["direction"].as<std::string>();
-                        robot_data.tag = parameter["tag"].as<std::string>();
-                        raw_data_.push_back(robot_data);
-
-                    }else {
-                        throw std::runtime_error("Unknown VFI type: " + vfi_type);
+            if (load_mode_ == LOAD_MODE::PARALLEL_DOM) {
+                _convert_items_parallel(vfi_array);
+            } else {
+                for (const auto& parameter : vfi_array) {
+                    try {
+                        raw_data_.push_back(_convert_item(parameter));
+                    }
+                    catch (const YAML::Exception& e) {
+                        std::cerr << "Error parsing VFI item: " << e.what() << std::endl;
+                        throw std::runtime_error(e.msg);
                     }
-                }
-                catch (const YAML::Exception& e) {
-                    std::cerr << "Error parsing VFI item: " << e.what() << std::endl;
-                    throw std::runtime_error(e.msg);
                 }
             }
         }
@@ -168,6 +899,81 @@ public:
 
     }
 
+    /**
+     * @brief _save_data writes a configuration file. See VFIConfigurationFileYaml::save_data().
+     * @param size The number of entries.
+     * @param get_item A function that returns a reference to the i-th entry, valid until the next call.
+     */
+    template<typename GetItem>
+    void _save_data(const std::size_t& size,
+                    const GetItem& get_item,
+                    const int &vfi_file_version,
+                    const bool &zero_indexed,
+                    const std::string &config_file)
+    {
+        try {
+            if (config_file.empty())
+                throw std::runtime_error("config_file path cannot be empty!");
+
+            // Create directory if it doesn't exist
+            std::filesystem::path file_path(config_file);
+            std::filesystem::path directory = file_path.parent_path();
+
+            if (!directory.empty() && !std::filesystem::exists(directory)) {
+                std::cout << "Creating directory: " << directory << std::endl;
+                std::filesystem::create_directories(directory);
+            }
+
+            FileWriter& file = file_writer_;
+            file.open(config_file);
+            YamlWriter writer(write_buffer_, file);
+            try {
+                // Write header using provided parameters
+                writer.append("vfi_file_version: ");
+                writer.append_int(vfi_file_version);
+                writer.append("\nzero_indexed: ");
+                writer.append(zero_indexed ? "true" : "false");
+                writer.append("\nvfi_array:\n");
+
+                // Write each data entry from the provided vector
+                for (std::size_t i = 0; i < size; ++i) {
+                    writer.append("  -\n");
+                    std::visit([&writer](auto&& arg) {
+                        using T = std::decay_t<decltype(arg)>;
+                        VFIDataFields::for_each<T>([&](const auto& field, auto index) {
+                            constexpr std::size_t I = decltype(index)::value;
+                            using FieldType = VFIDataFields::field_type<T, I>;
+                            const auto& value = arg.*field.member;
+                            writer.append_key(field.name);
+                            if constexpr (std::is_same_v<FieldType, std::string>)
+                                writer.append_string(value);
+                            else if constexpr (std::is_same_v<FieldType, std::vector<std::string>>)
+                                writer.append_string_list(value);
+                            else if constexpr (std::is_same_v<FieldType, int>)
+                                writer.append_int(value);
+                            else // The gain is always written with a decimal point
+                                writer.append_double(value, I == VFIDataFields::find<T>("vfi_gain"));
+                            writer.append("\n");
+                        });
+                    }, get_item(i));
+                }
+                writer.flush();
+            } catch (...) {
+                file.discard();
+                throw;
+            }
+            file.commit();
+
+            std::cout << "Successfully saved " << size
+                      << " VFI entries to: " << config_file << std::endl;
+
+        } catch (const std::filesystem::filesystem_error& e) {
+            throw std::runtime_error("Filesystem error in save_data: " + std::string(e.what()));
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Error in save_data: " + std::string(e.what()));
+        }
+    }
+
 };
 
 /**
@@ -175,13 +981,66 @@ public:
  * @param config_file The configuration YAML file. This path must contain the file and its format.
  *                    Example: "/path_to_the_file/config_file.yaml"
  */
-VFIConfigurationFileYaml::VFIConfigurationFileYaml()
+VFIConfigurationFileYaml::VFIConfigurationFileYaml(const LOAD_MODE& load_mode)
 {
     impl_ = std::make_shared<VFIConfigurationFileYaml::Impl>();
+    impl_->load_mode_ = load_mode;
     //impl_->config_file_ = config_file;
     //impl_->_extract_yaml_data();
 }
 
+/**
+ * @brief VFIConfigurationFileYaml::set_load_mode sets the strategy used by load_data().
+ * @param load_mode LOAD_MODE::DOM, LOAD_MODE::STREAMING or LOAD_MODE::PARALLEL_DOM.
+ */
+void VFIConfigurationFileYaml::set_load_mode(const LOAD_MODE& load_mode)
+{
+    impl_->load_mode_ = load_mode;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::get_load_mode gets the strategy used by load_data().
+ * @return The current load mode.
+ */
+VFIConfigurationFileYaml::LOAD_MODE VFIConfigurationFileYaml::get_load_mode() const
+{
+    return impl_->load_mode_;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::set_number_of_threads sets the number of threads used by
+ *        LOAD_MODE::PARALLEL_DOM to convert the vfi_array items.
+ * @param number_of_threads The number of threads. Zero (default) means one thread per core.
+ */
+void VFIConfigurationFileYaml::set_number_of_threads(const std::size_t& number_of_threads)
+{
+    impl_->number_of_threads_ = number_of_threads;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::get_number_of_threads gets the number of threads used by
+ *        LOAD_MODE::PARALLEL_DOM to convert the vfi_array items.
+ * @return The number of threads. Zero means one thread per core.
+ */
+std::size_t VFIConfigurationFileYaml::get_number_of_threads() const
+{
+    return impl_->number_of_threads_;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::new_instance creates a VFIConfigurationFileYaml with the same settings and no data.
+ * @return The new object.
+ */
+std::shared_ptr<VFIConfigurationFile> VFIConfigurationFileYaml::new_instance() const
+{
+    auto instance = std::make_shared<VFIConfigurationFileYaml>(impl_->load_mode_);
+    instance->set_number_of_threads(get_number_of_threads());
+    instance->set_save_mode(get_save_mode());
+    instance->set_sync_policy(get_sync_policy());
+    instance->set_parse_cache(get_parse_cache());
+    return instance;
+}
+
 /**
  * @brief VFIConfigurationFileYaml::load_data loads a configuration file.
  * @param config_file The name of the file including its path and format.
@@ -189,10 +1048,130 @@ VFIConfigurationFileYaml::VFIConfigurationFileYaml()
 void VFIConfigurationFileYaml::load_data(const std::string& config_file)
 {
     impl_->config_file_ = config_file;
-    impl_->_extract_yaml_data();
+    if (!impl_->parse_cache_)
+    {
+        impl_->_extract_yaml_data();
+        return;
+    }
+    std::vector<Data> data;
+    int vfi_file_version = impl_->vfi_file_version_;
+    bool zero_indexed = impl_->zero_indexed_;
+    impl_->parse_cache_->load(config_file, [&](std::vector<Data>& parsed_data, int& parsed_vfi_file_version,
+                                               bool& parsed_zero_indexed) {
+        impl_->_extract_yaml_data();
+        parsed_data.swap(impl_->raw_data_);
+        parsed_vfi_file_version = impl_->vfi_file_version_;
+        parsed_zero_indexed = impl_->zero_indexed_;
+    }, data, vfi_file_version, zero_indexed);
+    impl_->raw_data_ = std::move(data);
+    impl_->vfi_file_version_ = vfi_file_version;
+    impl_->zero_indexed_ = zero_indexed;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::set_parse_cache sets a cache of parsed files for load_data(). An unchanged
+ *        file is then read from the cache instead of being parsed. The objects created by new_instance()
+ *        share the cache.
+ * @param parse_cache The cache, or nullptr (default) to parse every file.
+ */
+void VFIConfigurationFileYaml::set_parse_cache(const std::shared_ptr<ParseCache>& parse_cache)
+{
+    impl_->parse_cache_ = parse_cache;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::get_parse_cache gets the cache of parsed files used by load_data().
+ * @return The cache, or nullptr.
+ */
+std::shared_ptr<ParseCache> VFIConfigurationFileYaml::get_parse_cache() const
+{
+    return impl_->parse_cache_;
+}
+
+
+
+/**
+ * @brief VFIConfigurationFileYaml::load_interned_data loads a configuration file and appends its data to
+ *        an InternedConstraintSet. In the STREAMING mode, each item is interned as soon as it is parsed, so
+ *        the whole file is never held as VFIConfigurationFile::Data. The data is not kept by this object,
+ *        so get_data() does not return it.
+ * @param config_file The name of the file including its path and format.
+ * @param interned_data The set that receives the data. If the load fails, the set may contain part
+ *                      of the items.
+ */
+void VFIConfigurationFileYaml::load_interned_data(const std::string& config_file, InternedConstraintSet& interned_data)
+{
+    impl_->_load_into([&](Data& data) {
+        interned_data.add_data(data);
+    }, config_file);
 }
 
+/**
+ * @brief VFIConfigurationFileYaml::load_pmr_data loads a configuration file and appends its data to
+ *        a vector of allocator-aware structs, whose memory comes from the memory resource of the vector
+ *        (e.g. a std::pmr::monotonic_buffer_resource that holds a whole editing session). In the STREAMING
+ *        mode, each item is copied to the vector as soon as it is parsed. The data is not kept by this
+ *        object, so get_data() does not return it.
+ * @param config_file The name of the file including its path and format.
+ * @param data The vector that receives the data. If the load fails, it may contain part of the items.
+ */
+void VFIConfigurationFileYaml::load_pmr_data(const std::string& config_file, std::pmr::vector<VFIPmrData::Data>& data)
+{
+    impl_->_load_into([&](Data& item) {
+        data.push_back(VFIPmrData::from_data(item, data.get_allocator()));
+    }, config_file);
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::set_save_mode sets how save_data() replaces the target file.
+ * @param save_mode FileWriter::SAVE_MODE::IN_PLACE (default) or FileWriter::SAVE_MODE::ATOMIC.
+ */
+void VFIConfigurationFileYaml::set_save_mode(const FileWriter::SAVE_MODE& save_mode)
+{
+    if (save_mode == FileWriter::SAVE_MODE::APPEND)
+        throw std::runtime_error("VFIConfigurationFileYaml::set_save_mode: The APPEND mode is not supported!");
+    impl_->file_writer_.set_save_mode(save_mode);
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::get_save_mode gets how save_data() replaces the target file.
+ * @return The current save mode.
+ */
+FileWriter::SAVE_MODE VFIConfigurationFileYaml::get_save_mode() const
+{
+    return impl_->file_writer_.get_save_mode();
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::set_sync_policy sets when the files written by save_data() are
+ *        flushed to the storage device.
+ * @param sync_policy The desired FileWriter::SYNC_POLICY. The default is NO_SYNC; use SYNC_EACH_FILE
+ *        (with FileWriter::SAVE_MODE::ATOMIC) when the saved file must survive a power loss.
+ */
+void VFIConfigurationFileYaml::set_sync_policy(const FileWriter::SYNC_POLICY& sync_policy)
+{
+    impl_->file_writer_.set_sync_policy(sync_policy);
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::get_sync_policy gets when the files written by save_data() are
+ *        flushed to the storage device.
+ * @return The current sync policy.
+ */
+FileWriter::SYNC_POLICY VFIConfigurationFileYaml::get_sync_policy() const
+{
+    return impl_->file_writer_.get_sync_policy();
+}
 
+/**
+ * @brief VFIConfigurationFileYaml::sync_pending_saves flushes the files saved with
+ *        FileWriter::SYNC_POLICY::DEFERRED_SYNC, and their directories once each.
+ *        Call it at the end of a bulk export.
+ */
+void VFIConfigurationFileYaml::sync_pending_saves()
+{
+    impl_->file_writer_.sync_pending();
+}
 
 /**
  * @brief VFIConfigurationFileYaml::get_raw_data gets the raw data vector from a YAML file.
@@ -205,6 +1184,29 @@ std::vector<VFIConfigurationFile::Data> VFIConfigurationFileYaml::get_data() con
     return impl_->raw_data_;
 }
 
+/**
+ * @brief VFIConfigurationFileYaml::take_data moves the data vector out of the object, without copying it.
+ *        The object is left without data. Unlike get_data(), it does not throw if there is no data.
+ * @return The data vector.
+ */
+std::vector<VFIConfigurationFile::Data> VFIConfigurationFileYaml::take_data()
+{
+    std::vector<VFIConfigurationFile::Data> data;
+    data.swap(impl_->raw_data_);
+    return data;
+}
+
+/**
+ * @brief VFIConfigurationFileYaml::view_data gives read-only access to the data vector, without copying it.
+ *        Unlike get_data(), it does not throw if there is no data. The reference is invalidated
+ *        by the next call to load_data() or take_data().
+ * @return The data vector.
+ */
+const std::vector<VFIConfigurationFile::Data>& VFIConfigurationFileYaml::view_data() const
+{
+    return impl_->raw_data_;
+}
+
 
 /**
  * @brief VFIConfigurationFileYaml::get_vfi_file_version gets the vfi_file_version data from
@@ -237,130 +1239,30 @@ void VFIConfigurationFileYaml::save_data(const std::vector<Data> &data,
                                          const bool &zero_indexed,
                                          const std::string &config_file)
 {
-    try {
-        if (config_file.empty())
-            throw std::runtime_error("config_file path cannot be empty!");
-
-        // Create directory if it doesn't exist
-        std::filesystem::path file_path(config_file);
-        std::filesystem::path directory = file_path.parent_path();
-
-        if (!directory.empty() && !std::filesystem::exists(directory)) {
-            std::cout << "Creating directory: " << directory << std::endl;
-            std::filesystem::create_directories(directory);
-        }
-
-        std::ofstream file(config_file);
-        if (!file.is_open()) {
-            throw std::runtime_error("Cannot open file for writing: " + config_file);
-        }
-
-        // Write header using provided parameters
-        file << "vfi_file_version: " << vfi_file_version << "\n";
-        file << "zero_indexed: " << (zero_indexed ? "true" : "false") << "\n";
-        file << "vfi_array:\n";
-
-        // Write each data entry from the provided vector
-        for (const auto& item : data) {
-            file << "  -\n";
-            std::visit([&file](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-
-                if constexpr (std::is_same_v<T, VFIConfigurationFile::ENVIRONMENT_TO_ROBOT_DATA>) {
-                    file << "    vfi_type: \"" << arg.vfi_type << "\"\n";
-
-                    // cs_entity_environment
-                    file << "    cs_entity_environment: [";
-                    for (size_t i = 0; i < arg.cs_entity_environment.size(); ++i) {
-                        file << "\"" << arg.cs_entity_environment[i] << "\"";
-                        if (i < arg.cs_entity_environment.size() - 1) file << ", ";
-                    }
-                    file << "]\n";
-
-                    // cs_entity_robot
-                    file << "    cs_entity_robot: [";
-                    for (size_t i = 0; i < arg.cs_entity_robot.size(); ++i) {
-                        file << "\"" << arg.cs_entity_robot[i] << "\"";
-                        if (i < arg.cs_entity_robot.size() - 1) file << ", ";
-                    }
-                    file << "]\n";
-
-                    file << "    entity_environment_primitive_type: \""
-                         << arg.entity_environment_primitive_type << "\"\n";
-                    file << "    entity_robot_primitive_type: \""
-                         << arg.entity_robot_primitive_type << "\"\n";
-                    file << "    robot_index: " << arg.robot_index << "\n";
-                    file << "    joint_index: " << arg.joint_index << "\n";
-                    file << "    safe_distance: " << arg.safe_distance << "\n";
-                    file << "    buffer: " << arg.buffer << "\n";
-
-                    // vfi_gain with .0 for integers
-                    file << "    vfi_gain: ";
-                    if (arg.vfi_gain == static_cast<int>(arg.vfi_gain)) {
-                        file << arg.vfi_gain << ".0";
-                    } else {
-                        file << arg.vfi_gain;
-                    }
-                    file << "\n";
-
-                    file << "    direction: \"" << arg.direction << "\"\n";
-                    file << "    tag: \"" << arg.tag << "\"\n";
-
-                } else if constexpr (std::is_same_v<T, VFIConfigurationFile::ROBOT_TO_ROBOT_DATA>) {
-                    file << "    vfi_type: \"" << arg.vfi_type << "\"\n";
-
-                    // cs_entity_one
-                    file << "    cs_entity_one: [";
-                    for (size_t i = 0; i < arg.cs_entity_one.size(); ++i) {
-                        file << "\"" << arg.cs_entity_one[i] << "\"";
-                        if (i < arg.cs_entity_one.size() - 1) file << ", ";
-                    }
-                    file << "]\n";
-
-                    // cs_entity_two
-                    file << "    cs_entity_two: [";
-                    for (size_t i = 0; i < arg.cs_entity_two.size(); ++i) {
-                        file << "\"" << arg.cs_entity_two[i] << "\"";
-                        if (i < arg.cs_entity_two.size() - 1) file << ", ";
-                    }
-                    file << "]\n";
-
-                    file << "    entity_one_primitive_type: \""
-                         << arg.entity_one_primitive_type << "\"\n";
-                    file << "    entity_two_primitive_type: \""
-                         << arg.entity_two_primitive_type << "\"\n";
-                    file << "    robot_index_one: " << arg.robot_index_one << "\n";
-                    file << "    robot_index_two: " << arg.robot_index_two << "\n";
-                    file << "    joint_index_one: " << arg.joint_index_one << "\n";
-                    file << "    joint_index_two: " << arg.joint_index_two << "\n";
-                    file << "    safe_distance: " << arg.safe_distance << "\n";
-                    file << "    buffer: " << arg.buffer << "\n";
-
-                    // vfi_gain with .0 for integers
-                    file << "    vfi_gain: ";
-                    if (arg.vfi_gain == static_cast<int>(arg.vfi_gain)) {
-                        file << arg.vfi_gain << ".0";
-                    } else {
-                        file << arg.vfi_gain;
-                    }
-                    file << "\n";
-
-                    file << "    direction: \"" << arg.direction << "\"\n";
-                    file << "    tag: \"" << arg.tag << "\"\n";
-                }
-            }, item);
-        }
-
-        file.close();
-
-        std::cout << "Successfully saved " << data.size()
-                  << " VFI entries to: " << config_file << std::endl;
+    impl_->_save_data(data.size(), [&](const std::size_t& i) -> const Data& {
+        return data[i];
+    }, vfi_file_version, zero_indexed, config_file);
+}
 
-    } catch (const std::filesystem::filesystem_error& e) {
-        throw std::runtime_error("Filesystem error in save_data: " + std::string(e.what()));
-    } catch (const std::exception& e) {
-        throw std::runtime_error("Error in save_data: " + std::string(e.what()));
-    }
+/**
+ * @brief VFIConfigurationFileYaml::save_interned_data saves a configuration file containing the constraints
+ *        of an InternedConstraintSet, in the order of the set. The entries are converted one at a time, so the
+ *        whole set is never held as VFIConfigurationFile::Data.
+ * @param interned_data The constraints.
+ * @param vfi_file_version The desired format version.
+ * @param zero_indexed To define if the data uses a zero-indexed convention.
+ * @param config_file The desired name of the file including its path and format.
+ */
+void VFIConfigurationFileYaml::save_interned_data(const InternedConstraintSet& interned_data,
+                                                  const int &vfi_file_version,
+                                                  const bool &zero_indexed,
+                                                  const std::string &config_file)
+{
+    Data item;
+    impl_->_save_data(interned_data.size(), [&](const std::size_t& i) -> const Data& {
+        interned_data.get_data(i, item);
+        return item;
+    }, vfi_file_version, zero_indexed, config_file);
 }
 
 